@@ -158,6 +158,20 @@ static inline int mbox_try_get(mbox_t *mbox, msg_t *msg)
     return _mbox_get(mbox, msg, NON_BLOCKING);
 }
 
+/**
+ * @brief Get the next message from mailbox without removing it
+ *
+ * The message stays in the mailbox, i.e. the next call to mbox_get() or
+ * mbox_try_get() retrieves the same message.
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ * @param[in] msg   ptr to storage for a copy of the message
+ *
+ * @return  1   if a message is queued in @p mbox
+ * @return  0   otherwise
+ */
+int mbox_peek(mbox_t *mbox, msg_t *msg);
+
 /**
  * @brief Get mbox queue size (capacity)
  *
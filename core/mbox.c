@@ -125,3 +125,16 @@ int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
         return 0;
     }
 }
+
+int mbox_peek(mbox_t *mbox, msg_t *msg)
+{
+    unsigned irqstate = irq_disable();
+    int res = (cib_avail(&mbox->cib) != 0);
+
+    if (res) {
+        /* copy msg from queue, but leave it there */
+        *msg = mbox->msg_array[cib_peek_unsafe(&mbox->cib)];
+    }
+    irq_restore(irqstate);
+    return res;
+}
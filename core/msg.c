@@ -35,10 +35,18 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static inline void _trace(uint8_t event, kernel_pid_t pid, const msg_t *m)
+{
+    if (IS_USED(MODULE_TRACE_MSG)) {
+        trace_event(event, ((uint32_t)(uint16_t)pid << 16) | m->type);
+    }
+}
+
 static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
@@ -105,6 +113,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+    _trace(TRACE_EV_MSG_SEND, target_pid, m);
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -209,6 +219,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    _trace(TRACE_EV_MSG_SEND, target_pid, m);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -308,6 +320,7 @@ int msg_reply(msg_t *m, msg_t *reply)
 
     DEBUG("msg_reply(): %" PRIkernel_pid ": Direct msg copy.\n",
           thread_getpid());
+    _trace(TRACE_EV_MSG_SEND, target->pid, reply);
     /* copy msg to target */
     msg_t *target_message = (msg_t *)target->wait_data;
 
@@ -335,6 +348,7 @@ int msg_reply_int(msg_t *m, msg_t *reply)
         return -1;
     }
 
+    _trace(TRACE_EV_MSG_SEND, target->pid, reply);
     msg_t *target_message = (msg_t *)target->wait_data;
 
     *target_message = *reply;
@@ -345,12 +359,20 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res == 1) {
+        _trace(TRACE_EV_MSG_RECV, m->sender_pid, m);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    _trace(TRACE_EV_MSG_RECV, m->sender_pid, m);
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -30,10 +30,18 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static inline void _trace(uint8_t event, mutex_t *mutex)
+{
+    if (IS_USED(MODULE_TRACE_MUTEX)) {
+        trace_event(event, (uintptr_t)mutex);
+    }
+}
+
 #if MAXTHREADS > 1
 
 /**
@@ -65,6 +73,7 @@ void _block(mutex_t *mutex,
     /* Fail visibly even if a blocking action is called from somewhere where
      * it's subtly not allowed, eg. board_init */
     assert(me != NULL);
+    _trace(TRACE_EV_MUTEX_BLOCK, mutex);
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
@@ -131,6 +140,7 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
         }
         _block(mutex, irq_state, pc);
     }
+    _trace(TRACE_EV_MUTEX_LOCK, mutex);
 
     return true;
 }
@@ -172,6 +182,7 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
+        _trace(TRACE_EV_MUTEX_LOCK, mutex);
         return 0;
     }
     else {
@@ -179,8 +190,10 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         if (mc->cancelled) {
             DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
                   "cancelled.\n", thread_getpid());
+            return -ECANCELED;
         }
-        return (mc->cancelled) ? -ECANCELED : 0;
+        _trace(TRACE_EV_MUTEX_LOCK, mutex);
+        return 0;
     }
 }
 
@@ -197,6 +210,7 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+    _trace(TRACE_EV_MUTEX_UNLOCK, mutex);
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
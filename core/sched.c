@@ -36,6 +36,10 @@
 #include "mpu.h"
 #endif
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE)
+#include "schedstatistics.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -267,6 +271,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE)
+            sched_statistics_runnable(process->pid);
+#endif
         }
     }
     else {
@@ -85,7 +85,7 @@ ssize_t stdio_read(void *buffer, size_t count)
     return 0;
 }
 
-ssize_t stdio_write(const void *buffer, size_t len)
+ssize_t STDIO_WRITE_BACKEND(const void *buffer, size_t len)
 {
     static unsigned short row = 0;
     static unsigned short cursor = 0;
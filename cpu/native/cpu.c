@@ -81,7 +81,7 @@ void _isr_switch_to_user(void) {
     /* Now we want to go to _native_isr_leave before resuming execution at _native_user_fptr. */
     _context_set_fptr(context, (uintptr_t)_native_isr_leave);
 
-    if (setcontext(context) == -1) {
+    if (_native_setcontext(context) == -1) {
         err(EXIT_FAILURE, "_isr_schedule_and_switch: setcontext");
     }
     errx(EXIT_FAILURE, "2 this should have never been reached!!");
@@ -126,7 +126,7 @@ void cpu_switch_context_exit(void)
         _native_in_isr = 1;
 
         _native_isr_context_make(_isr_context_switch_exit);
-        if (setcontext(_native_isr_context) == -1) {
+        if (_native_setcontext(_native_isr_context) == -1) {
             err(EXIT_FAILURE, "cpu_switch_context_exit: setcontext");
         }
         errx(EXIT_FAILURE, "1 this should have never been reached!!");
@@ -178,7 +178,7 @@ void thread_yield_higher(void)
 
         /* Create the ISR context, will execute isr_thread_yield */
         _native_isr_context_make(_isr_thread_yield);
-        if (swapcontext(_native_user_context(), _native_isr_context) == -1) {
+        if (_native_swapcontext(_native_user_context(), _native_isr_context) == -1) {
             err(EXIT_FAILURE, "thread_yield_higher: swapcontext");
         }
         irq_enable();
@@ -56,6 +56,35 @@ __attribute__((always_inline)) static inline uintptr_t cpu_get_caller_pc(void)
 }
 /** @} */
 
+/* MARK: - riotboot */
+/**
+ * @name    riotboot slot helpers
+ *
+ * native is not started by a bootloader, these only allow riotboot slots to
+ * be placed on the emulated flash, e.g. to test firmware updates.
+ * @{
+ */
+/**
+ * @brief   Get the start address of the running image
+ *
+ * @returns 0, the native image never runs from a riotboot slot
+ */
+static inline uint32_t cpu_get_image_baseaddr(void)
+{
+    return 0;
+}
+
+/**
+ * @brief   Jump to another image, not supported on native
+ *
+ * @param[in]   image_address   ignored
+ */
+static inline void cpu_jump_to_image(uint32_t image_address)
+{
+    (void)image_address;
+}
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @addtogroup cpu_native
+ * @{
+ *
+ * @file
+ * @brief   Context switching without system calls (`native_ctx_switch_asm`)
+ *
+ * `swapcontext()` and `setcontext()` save and restore the signal mask of the
+ * context, which costs a `rt_sigprocmask` system call each. With the
+ * `native_ctx_switch_asm` module, contexts are switched by a register switch
+ * in `native.S` instead, which operates on the same `ucontext_t` structures
+ * but leaves the signal mask alone. The signal mask then stays the same
+ * while RIOT runs: @ref irq_disable only sets a flag, and signals arriving
+ * while interrupts are disabled are queued by `native_signal_action` and
+ * handled once interrupts are enabled again.
+ *
+ * Only available for x86_64 Linux with glibc's `ucontext_t` layout, which
+ * is shared with the assembly code through the offsets below.
+ */
+
+/**
+ * @name    Offsets into glibc's x86_64 `ucontext_t`
+ * @{
+ */
+#define NATIVE_CTX_OFFSET_RBP       (120)   /**< gregs[REG_RBP] */
+#define NATIVE_CTX_OFFSET_RBX       (128)   /**< gregs[REG_RBX] */
+#define NATIVE_CTX_OFFSET_R12       (72)    /**< gregs[REG_R12] */
+#define NATIVE_CTX_OFFSET_R13       (80)    /**< gregs[REG_R13] */
+#define NATIVE_CTX_OFFSET_R14       (88)    /**< gregs[REG_R14] */
+#define NATIVE_CTX_OFFSET_R15       (96)    /**< gregs[REG_R15] */
+#define NATIVE_CTX_OFFSET_RDI       (104)   /**< gregs[REG_RDI] */
+#define NATIVE_CTX_OFFSET_RSI       (112)   /**< gregs[REG_RSI] */
+#define NATIVE_CTX_OFFSET_RSP       (160)   /**< gregs[REG_RSP] */
+#define NATIVE_CTX_OFFSET_RIP       (168)   /**< gregs[REG_RIP] */
+#define NATIVE_CTX_OFFSET_FPU_CW    (424)   /**< __fpregs_mem.cwd */
+#define NATIVE_CTX_OFFSET_MXCSR     (448)   /**< __fpregs_mem.mxcsr */
+/** @} */
+
+#ifndef __ASSEMBLER__
+
+#include <stddef.h>
+#include <ucontext.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(__x86_64__) || !defined(__linux__) || USE_LIBUCONTEXT
+#  error "native_ctx_switch_asm requires x86_64 Linux with glibc ucontext"
+#endif
+
+#ifndef DOXYGEN
+#define _NATIVE_CTX_CHECK_GREG(reg) \
+    _Static_assert(offsetof(ucontext_t, uc_mcontext.gregs[REG_ ## reg]) == \
+                   NATIVE_CTX_OFFSET_ ## reg, "ucontext_t layout mismatch")
+_NATIVE_CTX_CHECK_GREG(RBP);
+_NATIVE_CTX_CHECK_GREG(RBX);
+_NATIVE_CTX_CHECK_GREG(R12);
+_NATIVE_CTX_CHECK_GREG(R13);
+_NATIVE_CTX_CHECK_GREG(R14);
+_NATIVE_CTX_CHECK_GREG(R15);
+_NATIVE_CTX_CHECK_GREG(RDI);
+_NATIVE_CTX_CHECK_GREG(RSI);
+_NATIVE_CTX_CHECK_GREG(RSP);
+_NATIVE_CTX_CHECK_GREG(RIP);
+_Static_assert(offsetof(ucontext_t, __fpregs_mem.cwd) == NATIVE_CTX_OFFSET_FPU_CW,
+               "ucontext_t layout mismatch");
+_Static_assert(offsetof(ucontext_t, __fpregs_mem.mxcsr) == NATIVE_CTX_OFFSET_MXCSR,
+               "ucontext_t layout mismatch");
+#undef _NATIVE_CTX_CHECK_GREG
+#endif
+
+/**
+ * @brief   Saves the current context to @p from and applies @p to
+ *
+ * Like `swapcontext()`, but does not save or restore the signal mask.
+ * Only the registers preserved across function calls are saved.
+ *
+ * @note    This function is implemented in assembly, see `native.S`
+ */
+void _native_ctx_swap(ucontext_t *from, ucontext_t *to);
+
+/**
+ * @brief   Applies @p to
+ *
+ * Like `setcontext()`, but does not restore the signal mask. @p to may have
+ * been created using `getcontext()`/`makecontext()` or @ref _native_ctx_swap.
+ *
+ * @note    This function is implemented in assembly, see `native.S`
+ */
+__attribute__((noreturn)) void _native_ctx_set(ucontext_t *to);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSEMBLER__ */
+
+/** @} */
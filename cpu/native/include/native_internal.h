@@ -53,6 +53,9 @@
 #include "cpu_conf.h"
 #include "thread.h"
 #include "sched.h"
+#ifdef MODULE_NATIVE_CTX_SWITCH_ASM
+#include "native_ctx_switch.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -250,6 +253,37 @@ static inline void _native_isr_context_make(void (*func)(void)) {
     makecontext(_native_isr_context, func, 0);
 }
 
+/**
+ * @brief Saves the current context to @p from and applies @p to
+ *
+ * Uses `swapcontext`, or @ref _native_ctx_swap with `native_ctx_switch_asm`.
+ *
+ * @returns 0 on success, -1 otherwise
+ */
+static inline int _native_swapcontext(ucontext_t *from, ucontext_t *to) {
+#ifdef MODULE_NATIVE_CTX_SWITCH_ASM
+    _native_ctx_swap(from, to);
+    return 0;
+#else
+    return swapcontext(from, to);
+#endif
+}
+
+/**
+ * @brief Applies @p to
+ *
+ * Uses `setcontext`, or @ref _native_ctx_set with `native_ctx_switch_asm`.
+ *
+ * @returns -1 on error, does not return otherwise
+ */
+static inline int _native_setcontext(ucontext_t *to) {
+#ifdef MODULE_NATIVE_CTX_SWITCH_ASM
+    _native_ctx_set(to);
+#else
+    return setcontext(to);
+#endif
+}
+
 /**
  * @brief Retrieves user context
  * @returns `ucontext_t`
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @addtogroup cpu_native
+ * @{
+ *
+ * @file
+ * @brief   Native timer wakeup latency statistics
+ *
+ * The native timer peripheral is emulated using a POSIX interval timer that
+ * is armed relative to the current time and signals `SIGALRM`. Offsets
+ * shorter than @ref NATIVE_TIMER_MIN_RES are extended.
+ *
+ * With the `native_timer_latency` module, the time between the deadline of
+ * the timer and the execution of its interrupt handler is recorded in a
+ * histogram. This shows how much of a timer's latency is caused by the host,
+ * not by RIOT.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets of the wakeup latency histogram
+ *
+ * Bucket 0 counts latencies below 1 µs, bucket `i` counts latencies in
+ * [2^(i-1), 2^i) µs, and the last bucket counts everything beyond.
+ */
+#define NATIVE_TIMER_LATENCY_BUCKETS    (16U)
+
+/**
+ * @brief   Wakeup latency statistics
+ */
+typedef struct {
+    uint32_t hist[NATIVE_TIMER_LATENCY_BUCKETS];    /**< latency histogram */
+    uint32_t count;                                 /**< number of interrupts */
+    uint32_t max;                                   /**< maximum latency in µs */
+    uint64_t sum;                                   /**< sum of latencies in µs */
+} native_timer_latency_t;
+
+/**
+ * @brief   Get the wakeup latency statistics of the timer
+ *
+ * @param[out]  stats   statistics since startup or the last reset
+ */
+void native_timer_latency_get(native_timer_latency_t *stats);
+
+/**
+ * @brief   Reset the wakeup latency statistics of the timer
+ */
+void native_timer_latency_reset(void);
+
+/**
+ * @brief   Print the wakeup latency statistics of the timer
+ */
+void native_timer_latency_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
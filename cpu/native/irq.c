@@ -23,6 +23,7 @@
 
 #include "irq.h"
 #include "cpu.h"
+#include "modules.h"
 #include "periph/pm.h"
 
 #include "native_internal.h"
@@ -52,10 +53,32 @@ static _native_callback_t _native_irq_handlers[255];
 
 static inline void _set_sigmask(ucontext_t *ctx)
 {
-    ctx->uc_sigmask = _native_sig_set_dint;
+    /* With native_ctx_switch_asm, the signal mask is never changed.
+     * Signals are deferred by native_signal_action() instead. */
+    if (!IS_USED(MODULE_NATIVE_CTX_SWITCH_ASM)) {
+        ctx->uc_sigmask = _native_sig_set_dint;
+    }
     _native_interrupts_enabled = false;
 }
 
+/* With native_ctx_switch_asm, the signal mask is set once and blocks
+ * nothing: native_signal_action() defers the signals of the IRQ layer while
+ * IRQs are disabled, and all other signals keep their default action. */
+static inline void _init_sigmask(void)
+{
+    sigset_t none;
+
+    if (!IS_USED(MODULE_NATIVE_CTX_SWITCH_ASM)) {
+        return;
+    }
+    if (sigemptyset(&none) == -1) {
+        err(EXIT_FAILURE, "_init_sigmask: sigemptyset");
+    }
+    if (sigprocmask(SIG_SETMASK, &none, NULL) == -1) {
+        err(EXIT_FAILURE, "_init_sigmask: sigprocmask");
+    }
+}
+
 void *thread_isr_stack_pointer(void)
 {
     return _native_isr_context->uc_stack.ss_sp;
@@ -155,7 +178,8 @@ unsigned irq_disable(void)
         DEBUG_IRQ("irq_disable + _native_in_isr\n");
     }
 
-    if (sigprocmask(SIG_SETMASK, &_native_sig_set_dint, NULL) == -1) {
+    if (!IS_USED(MODULE_NATIVE_CTX_SWITCH_ASM)
+        && sigprocmask(SIG_SETMASK, &_native_sig_set_dint, NULL) == -1) {
         err(EXIT_FAILURE, "irq_disable: sigprocmask");
     }
 
@@ -188,12 +212,15 @@ unsigned irq_enable(void)
 
     /* Mark the IRQ as enabled first since sigprocmask could call the handler
      * before returning to userspace.
+     * With native_ctx_switch_asm, signals are not blocked but deferred while
+     * IRQs are disabled. _native_syscall_leave() handles them below.
      */
 
     prev_state = _native_interrupts_enabled;
     _native_interrupts_enabled = true;
 
-    if (sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
+    if (!IS_USED(MODULE_NATIVE_CTX_SWITCH_ASM)
+        && sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
         err(EXIT_FAILURE, "irq_enable: sigprocmask");
     }
 
@@ -260,7 +287,8 @@ void _native_call_sig_handlers_and_switch(void)
 
     while (_native_pending_signals > 0) {
         int sig = _native_pop_sig();
-        _native_pending_signals--;
+        /* native_signal_action() may increment this concurrently */
+        __atomic_fetch_sub(&_native_pending_signals, 1, __ATOMIC_RELAXED);
 
         if (_native_irq_handlers[sig]) {
             DEBUG_IRQ("call sig handlers + switch: calling interrupt handler for %i\n", sig);
@@ -495,5 +523,7 @@ void native_interrupt_init(void)
         err(EXIT_FAILURE, "native_interrupt_init: sigaction");
     }
 
+    _init_sigmask();
+
     puts("RIOT native interrupts/signals initialized.");
 }
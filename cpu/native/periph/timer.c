@@ -26,16 +26,22 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <signal.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
 #include <time.h>
 
+#include "bitarithm.h"
 #include "cpu.h"
 #include "cpu_conf.h"
+#include "irq.h"
+#include "modules.h"
 #include "native_internal.h"
+#include "native_timer.h"
 #include "panic.h"
 #include "periph/timer.h"
 #include "time_units.h"
@@ -54,6 +60,14 @@ static struct itimerspec its;
 
 static timer_t itimer_monotonic;
 
+#if IS_USED(MODULE_NATIVE_TIMER_LATENCY)
+static native_timer_latency_t _latency;
+/* deadline and period of the armed timer in ticks */
+static uint32_t _deadline;
+static uint32_t _period;
+static bool _armed;
+#endif
+
 /**
  * returns ticks for give timespec
  */
@@ -63,6 +77,35 @@ static unsigned long ts2ticks(struct timespec *tp)
     return (((unsigned long)tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
 }
 
+#if IS_USED(MODULE_NATIVE_TIMER_LATENCY)
+static void _record_latency(void)
+{
+    uint32_t latency = timer_read(0) - _deadline;
+
+    /* a signal of a timer that was set again may still be pending */
+    if (!_armed || (int32_t)latency < 0) {
+        return;
+    }
+    if (_period) {
+        _deadline += _period;
+    }
+    else {
+        _armed = false;
+    }
+
+    unsigned bucket = latency ? bitarithm_msb(latency) + 1 : 0;
+    if (bucket >= NATIVE_TIMER_LATENCY_BUCKETS) {
+        bucket = NATIVE_TIMER_LATENCY_BUCKETS - 1;
+    }
+    _latency.hist[bucket]++;
+    _latency.count++;
+    _latency.sum += latency;
+    if (latency > _latency.max) {
+        _latency.max = latency;
+    }
+}
+#endif
+
 /**
  * native timer signal handler
  *
@@ -72,9 +115,51 @@ void native_isr_timer(void)
 {
     DEBUG("%s\n", __func__);
 
+#if IS_USED(MODULE_NATIVE_TIMER_LATENCY)
+    _record_latency();
+#endif
+
     _callback(_cb_arg, 0);
 }
 
+#if IS_USED(MODULE_NATIVE_TIMER_LATENCY)
+void native_timer_latency_get(native_timer_latency_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _latency;
+    irq_restore(state);
+}
+
+void native_timer_latency_reset(void)
+{
+    unsigned state = irq_disable();
+    memset(&_latency, 0, sizeof(_latency));
+    irq_restore(state);
+}
+
+void native_timer_latency_print(void)
+{
+    native_timer_latency_t stats;
+
+    native_timer_latency_get(&stats);
+
+    printf("timer latency: %" PRIu32 " IRQs, avg %" PRIu32 " us, max %" PRIu32 " us\n",
+           stats.count, stats.count ? (uint32_t)(stats.sum / stats.count) : 0,
+           stats.max);
+    for (unsigned i = 0; i < NATIVE_TIMER_LATENCY_BUCKETS; i++) {
+        if (!stats.hist[i]) {
+            continue;
+        }
+        if (i == NATIVE_TIMER_LATENCY_BUCKETS - 1) {
+            printf("  >= %5u us: %" PRIu32 "\n", 1U << (i - 1), stats.hist[i]);
+        }
+        else {
+            printf("  <  %5u us: %" PRIu32 "\n", 1U << i, stats.hist[i]);
+        }
+    }
+}
+#endif
+
 uword_t timer_query_freqs_numof(tim_t dev)
 {
     (void)dev;
@@ -201,6 +286,12 @@ void timer_start(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#if IS_USED(MODULE_NATIVE_TIMER_LATENCY)
+    _armed = its.it_value.tv_sec || its.it_value.tv_nsec;
+    _deadline = timer_read(dev) + ts2ticks(&its.it_value);
+    _period = ts2ticks(&its.it_interval);
+#endif
+
     _native_syscall_enter();
     if (timer_settime(itimer_monotonic, 0, &its, NULL) == -1) {
         core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
@@ -213,6 +304,10 @@ void timer_stop(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#if IS_USED(MODULE_NATIVE_TIMER_LATENCY)
+    _armed = false;
+#endif
+
     _native_syscall_enter();
     struct itimerspec zero = {0};
     if (timer_settime(itimer_monotonic, 0, &zero, &its) == -1) {
@@ -63,18 +63,20 @@ static void io_signal_handler(int fd, void *arg)
     int is_first = 1;
 
     while (1) {
-        char c;
-        int status = real_read(fd, &c, 1);
+        /* read in blocks, a system call per byte limits the throughput */
+        uint8_t buf[64];
+        ssize_t status = real_read(fd, buf, sizeof(buf));
 
-        if (status == 1) {
+        if (status > 0) {
             if (is_first) {
                 is_first = 0;
                 DEBUG("read char from serial port");
             }
 
-            DEBUG(" %02x", (unsigned char) c);
-
-            uart_config[uart].rx_cb(uart_config[uart].arg, c);
+            for (ssize_t i = 0; (i < status) && uart_config[uart].rx_cb; i++) {
+                DEBUG(" %02x", buf[i]);
+                uart_config[uart].rx_cb(uart_config[uart].arg, buf[i]);
+            }
         } else {
             if (status == -1 && errno != EAGAIN) {
                 DEBUG("error: cannot read from serial port\n");
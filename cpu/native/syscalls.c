@@ -84,7 +84,7 @@ void _native_syscall_leave(void)
         _native_interrupts_enabled = false;
 
         _native_isr_context_make(_native_call_sig_handlers_and_switch);
-        if (swapcontext(_native_user_context(), _native_isr_context) == -1) {
+        if (_native_swapcontext(_native_user_context(), _native_isr_context) == -1) {
             err(EXIT_FAILURE, "_native_syscall_leave: swapcontext");
         }
     }
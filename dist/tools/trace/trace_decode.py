@@ -0,0 +1,233 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Decodes the binary export of the `trace` module, as written by
+`trace_export_file()` or printed by `trace_export_stdio()`, into text or into
+a JSON trace that can be opened with https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b"RTRC"
+VERSION = 1
+HDR = "4sBBBBII"
+THREAD = "B15s"
+ENTRY = "IIBBBB"
+FLAG_ISR = 0x01
+
+EV_USER = 0
+EV_THREAD_SWITCH = 1
+EV_ISR_ENTER = 2
+EV_ISR_EXIT = 3
+EV_MSG_SEND = 4
+EV_MSG_RECV = 5
+EV_MUTEX_LOCK = 6
+EV_MUTEX_BLOCK = 7
+EV_MUTEX_UNLOCK = 8
+EV_NETIF_SEND = 9
+EV_NETIF_RECV = 10
+EV_APP = 0x80
+
+EVENTS = {
+    EV_USER: "trace",
+    EV_THREAD_SWITCH: "switch",
+    EV_ISR_ENTER: "isr_enter",
+    EV_ISR_EXIT: "isr_exit",
+    EV_MSG_SEND: "msg_send",
+    EV_MSG_RECV: "msg_recv",
+    EV_MUTEX_LOCK: "mutex_lock",
+    EV_MUTEX_BLOCK: "mutex_block",
+    EV_MUTEX_UNLOCK: "mutex_unlock",
+    EV_NETIF_SEND: "netif_send",
+    EV_NETIF_RECV: "netif_recv",
+}
+
+# track of ISRs and of entries recorded in interrupt context
+ISR_TID = 0
+
+TRACE_LINE = re.compile(r"trace: ([0-9a-fA-F]+)\s*$")
+
+
+class Trace:
+    """
+    Decoded trace buffer
+    """
+
+    def __init__(self, data):
+        if data[:4] != MAGIC:
+            raise ValueError("no trace export")
+        order = ">" if data[7] else "<"
+        (_, version, entry_size, threads, _, entries,
+         self.lost) = struct.unpack_from(order + HDR, data)
+        if version != VERSION or entry_size != struct.calcsize(order + ENTRY):
+            raise ValueError("unsupported export version {}".format(version))
+        offset = struct.calcsize(HDR)
+        self.threads = {}
+        for _ in range(threads):
+            pid, name = struct.unpack_from(order + THREAD, data, offset)
+            offset += struct.calcsize(THREAD)
+            if pid:
+                name = name.split(b"\0")[0].decode(errors="replace")
+                self.threads[pid] = name or "pid {}".format(pid)
+        self.entries = []
+        last = None
+        for time, arg, ev, pid, flags, _ in struct.iter_unpack(
+                order + ENTRY, data[offset:offset + entries * entry_size]):
+            # unwrap the 32 bit time stamps, entries may be slightly out of
+            # order when recorded concurrently
+            if last is None:
+                last = time
+                abs_time = time
+            else:
+                delta = (time - (last & 0xffffffff)) & 0xffffffff
+                if delta >= 0x80000000:
+                    delta -= 0x100000000
+                abs_time = last + delta
+                last = max(last, abs_time)
+            self.entries.append((abs_time, ev, pid, flags, arg))
+        self.entries.sort(key=lambda entry: entry[0])
+
+    def thread_name(self, pid):
+        if pid == 0:
+            return "none"
+        return self.threads.get(pid, "pid {}".format(pid))
+
+
+def event_name(ev, names):
+    if ev in names:
+        return names[ev]
+    if ev >= EV_APP:
+        return "app+{}".format(ev - EV_APP)
+    return EVENTS.get(ev, "event {}".format(ev))
+
+
+def describe(trace, ev, arg):
+    if ev == EV_THREAD_SWITCH:
+        return "to {}".format(trace.thread_name(arg))
+    if ev in (EV_MSG_SEND, EV_MSG_RECV):
+        return "{} {} type=0x{:04x}".format(
+            "to" if ev == EV_MSG_SEND else "from",
+            trace.thread_name(arg >> 16), arg & 0xffff)
+    if ev in (EV_MUTEX_LOCK, EV_MUTEX_BLOCK, EV_MUTEX_UNLOCK):
+        return "mutex=0x{:08x}".format(arg)
+    if ev in (EV_NETIF_SEND, EV_NETIF_RECV):
+        return "netif={} len={}".format(arg >> 16, arg & 0xffff)
+    if ev in (EV_ISR_ENTER, EV_ISR_EXIT):
+        return "irq={}".format(arg)
+    return "0x{:08x}".format(arg)
+
+
+def to_text(trace, names, out):
+    if trace.lost:
+        print("# {} older entries were overwritten".format(trace.lost),
+              file=out)
+    for time, ev, pid, flags, arg in trace.entries:
+        print("{:>12} {:<16} {:<13} {}".format(
+            time, trace.thread_name(pid) + (" isr" if flags & FLAG_ISR else ""),
+            event_name(ev, names), describe(trace, ev, arg)), file=out)
+
+
+def to_perfetto(trace, names, out):
+    events = [{"ph": "M", "name": "process_name", "pid": 1, "tid": ISR_TID,
+               "args": {"name": "RIOT"}},
+              {"ph": "M", "name": "thread_name", "pid": 1, "tid": ISR_TID,
+               "args": {"name": "ISR"}}]
+    for pid, name in trace.threads.items():
+        events.append({"ph": "M", "name": "thread_name", "pid": 1,
+                       "tid": pid, "args": {"name": name}})
+
+    running = None
+    waiting = {}
+    for time, ev, pid, flags, arg in trace.entries:
+        tid = ISR_TID if flags & FLAG_ISR else pid
+        if ev == EV_THREAD_SWITCH:
+            if running is not None and running[0]:
+                events.append({"ph": "X", "name": "running", "pid": 1,
+                               "tid": running[0], "ts": running[1],
+                               "dur": time - running[1]})
+            running = (arg, time)
+        elif ev in (EV_ISR_ENTER, EV_ISR_EXIT):
+            events.append({"ph": "B" if ev == EV_ISR_ENTER else "E",
+                           "name": "irq {}".format(arg), "pid": 1,
+                           "tid": ISR_TID, "ts": time})
+        elif ev == EV_MUTEX_BLOCK:
+            waiting[(tid, arg)] = time
+        elif ev == EV_MUTEX_LOCK and (tid, arg) in waiting:
+            start = waiting.pop((tid, arg))
+            events.append({"ph": "X", "name": "mutex wait", "pid": 1,
+                           "tid": tid, "ts": start, "dur": time - start,
+                           "args": {"mutex": "0x{:08x}".format(arg)}})
+        else:
+            events.append({"ph": "i", "s": "t", "name": event_name(ev, names),
+                           "pid": 1, "tid": tid, "ts": time,
+                           "args": {"arg": describe(trace, ev, arg)}})
+    if running is not None and running[0] and trace.entries:
+        end = trace.entries[-1][0]
+        events.append({"ph": "X", "name": "running", "pid": 1,
+                       "tid": running[0], "ts": running[1],
+                       "dur": end - running[1]})
+    json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, out)
+    out.write("\n")
+
+
+def read_export(data):
+    """
+    Returns the binary export in @p data, which is either the export itself
+    or the output of `trace_export_stdio()`
+    """
+    if data[:4] == MAGIC:
+        return data
+    export = None
+    for line in data.decode(errors="replace").splitlines():
+        if line.rstrip().endswith("trace: begin"):
+            export = bytearray()
+        elif line.rstrip().endswith("trace: end") and export is not None:
+            return bytes(export)
+        elif export is not None:
+            match = TRACE_LINE.search(line)
+            if match:
+                export += bytes.fromhex(match.group(1))
+    raise ValueError("no complete trace export found")
+
+
+def parse_name(arg):
+    ev, _, name = arg.partition("=")
+    return int(ev, 0), name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("input", nargs="?", type=argparse.FileType("rb"),
+                        default=sys.stdin.buffer,
+                        help="binary export or log containing the output of "
+                             "trace_export_stdio(), default: stdin")
+    parser.add_argument("-f", "--format", choices=("text", "perfetto"),
+                        default="text", help="output format")
+    parser.add_argument("-e", "--event", type=parse_name, action="append",
+                        default=[], metavar="ID=NAME",
+                        help="name of an application event, e.g. 0x80=rx")
+    args = parser.parse_args()
+
+    try:
+        trace = Trace(read_export(args.input.read()))
+    except (ValueError, struct.error) as exc:
+        sys.exit("{}: {}".format(args.input.name, exc))
+    names = dict(args.event)
+    if args.format == "perfetto":
+        to_perfetto(trace, names, sys.stdout)
+    else:
+        to_text(trace, names, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
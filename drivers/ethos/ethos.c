@@ -25,6 +25,7 @@
 
 #include "ethos.h"
 #include "periph/uart.h"
+#include "string_utils.h"
 #include "tsrb.h"
 #include "irq.h"
 
@@ -228,26 +229,27 @@ static size_t iolist_count_total(const iolist_t *iolist)
     return result;
 }
 
-static void _write_escaped(uart_t uart, uint8_t c)
+static void _write_escaped(uart_t uart, const uint8_t *data, size_t len)
 {
-    const uint8_t *out;
-    int n;
-
-    switch(c) {
-        case ETHOS_FRAME_DELIMITER:
-            out = _esc_delim;
-            n = 2;
-            break;
-        case ETHOS_ESC_CHAR:
-            out = _esc_esc;
-            n = 2;
+    const uint8_t *end = data + len;
+
+    while (data != end) {
+        /* write everything up to the next byte that needs escaping at once,
+         * so that the UART driver can use DMA for it */
+        const uint8_t *esc = memchr2(data, ETHOS_FRAME_DELIMITER,
+                                     ETHOS_ESC_CHAR, end - data);
+        if (esc == NULL) {
+            esc = end;
+        }
+        if (esc != data) {
+            uart_write(uart, data, esc - data);
+        }
+        if (esc == end) {
             break;
-        default:
-            out = &c;
-            n = 1;
+        }
+        uart_write(uart, (*esc == ETHOS_ESC_CHAR) ? _esc_esc : _esc_delim, 2);
+        data = esc + 1;
     }
-
-    uart_write(uart, out, n);
 }
 
 void ethos_send_frame(ethos_t *dev, const uint8_t *data, size_t len, unsigned frame_type)
@@ -266,9 +268,7 @@ void ethos_send_frame(ethos_t *dev, const uint8_t *data, size_t len, unsigned fr
     }
 
     /* send frame content */
-    while(len--) {
-        _write_escaped(dev->uart, *data++);
-    }
+    _write_escaped(dev->uart, data, len);
 
     /* end of frame */
     uart_write(dev->uart, &frame_delim, 1);
@@ -293,11 +293,7 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 
     /* send iolist */
     for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
-        size_t n = iol->iol_len;
-        uint8_t *ptr = iol->iol_base;
-        while(n--) {
-            _write_escaped(dev->uart, *ptr++);
-        }
+        _write_escaped(dev->uart, iol->iol_base, iol->iol_len);
     }
 
     uart_write(dev->uart, &frame_delim, 1);
@@ -361,30 +357,61 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void* info)
     int res = 0;
 
     if (buf) {
-        int byte;
         bool escaped = false;
+        bool end_of_frame = false;
         uint8_t *ptr = buf;
         uint8_t frametype = ETHOS_FRAME_TYPE_DATA;
 
-        do {
-            int tmp;
+        while (!end_of_frame) {
+            uint8_t chunk[32];
+            int n = tsrb_peek(&dev->inbuf, chunk, sizeof(chunk));
 
-            if ((byte = tsrb_get_one(&dev->inbuf)) < 0) {
+            if (n <= 0) {
                 DEBUG("ethos _recv(): inbuf doesn't contain enough bytes.\n");
                 return -EIO;
             }
-            if ((unsigned)res >= len) {
-                while (byte != (int)ETHOS_FRAME_DELIMITER && byte >= 0) {
+
+            const uint8_t *pos = chunk;
+            const uint8_t *end = chunk + n;
+
+            while ((pos != end) && !end_of_frame) {
+                if (!escaped) {
+                    /* copy everything up to the next delimiter or escape
+                     * character at once */
+                    const uint8_t *special = memchr2(pos, ETHOS_FRAME_DELIMITER,
+                                                     ETHOS_ESC_CHAR, end - pos);
+                    size_t run = (special ? special : end) - pos;
+
+                    if (run > len - res) {
+                        run = len - res;
+                    }
+                    memcpy(ptr, pos, run);
+                    ptr += run;
+                    res += run;
+                    pos += run;
+                    if (pos == end) {
+                        break;
+                    }
+                }
+                if ((unsigned)res >= len) {
                     /* clear out unreceived packet */
-                    byte = tsrb_get_one(&dev->inbuf);
+                    tsrb_drop(&dev->inbuf, pos - chunk);
+                    int byte;
+                    do {
+                        byte = tsrb_get_one(&dev->inbuf);
+                    } while ((byte != (int)ETHOS_FRAME_DELIMITER) && (byte >= 0));
+                    return -ENOBUFS;
                 }
-                return -ENOBUFS;
-            }
 
-            tmp = ethos_unstuff_readbyte(ptr, (uint8_t)byte, &escaped, &frametype);
-            ptr += tmp;
-            res += tmp;
-        } while (byte != ETHOS_FRAME_DELIMITER);
+                uint8_t byte = *pos++;
+                unsigned tmp = ethos_unstuff_readbyte(ptr, byte, &escaped,
+                                                      &frametype);
+                ptr += tmp;
+                res += tmp;
+                end_of_frame = (byte == ETHOS_FRAME_DELIMITER);
+            }
+            tsrb_drop(&dev->inbuf, pos - chunk);
+        }
 
         switch (frametype) {
         case ETHOS_FRAME_TYPE_HELLO:
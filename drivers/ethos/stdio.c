@@ -78,7 +78,7 @@ ssize_t stdio_read(void* buffer, size_t len)
     return ptr - (uint8_t *)buffer;
 }
 
-ssize_t stdio_write(const void* buffer, size_t len)
+ssize_t STDIO_WRITE_BACKEND(const void* buffer, size_t len)
 {
     ethos_send_frame(&ethos, (const uint8_t *)buffer, len, ETHOS_FRAME_TYPE_TEXT);
     return len;
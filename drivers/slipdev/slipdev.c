@@ -32,6 +32,7 @@
 #include "isrpipe.h"
 #include "mutex.h"
 #include "stdio_uart.h"
+#include "string_utils.h"
 
 static int _check_state(slipdev_t *dev);
 
@@ -178,21 +179,29 @@ static int _init(netdev_t *netdev)
 
 void slipdev_write_bytes(uart_t uart, const uint8_t *data, size_t len)
 {
-    for (unsigned j = 0; j < len; j++, data++) {
-        switch (*data) {
-            case SLIPDEV_END:
-                /* escaping END byte*/
-                slipdev_write_byte(uart, SLIPDEV_ESC);
-                slipdev_write_byte(uart, SLIPDEV_END_ESC);
-                break;
-            case SLIPDEV_ESC:
-                /* escaping ESC byte*/
-                slipdev_write_byte(uart, SLIPDEV_ESC);
-                slipdev_write_byte(uart, SLIPDEV_ESC_ESC);
-                break;
-            default:
-                slipdev_write_byte(uart, *data);
+    const uint8_t *end = data + len;
+
+    while (data != end) {
+        /* write everything up to the next byte that needs escaping at once,
+         * so that the UART driver can use DMA for it */
+        const uint8_t *esc = memchr2(data, SLIPDEV_END, SLIPDEV_ESC,
+                                     end - data);
+        if (esc == NULL) {
+            esc = end;
         }
+        if (esc != data) {
+            uart_write(uart, data, esc - data);
+        }
+        if (esc == end) {
+            break;
+        }
+
+        uint8_t out[2] = {
+            SLIPDEV_ESC,
+            (*esc == SLIPDEV_END) ? SLIPDEV_END_ESC : SLIPDEV_ESC_ESC,
+        };
+        uart_write(uart, out, sizeof(out));
+        data = esc + 1;
     }
 }
 
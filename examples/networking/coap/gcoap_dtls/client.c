@@ -21,6 +21,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -256,6 +257,11 @@ int gcoap_cli_cmd(int argc, char **argv)
         printf("Connection secured with DTLS\n");
         printf("Free DTLS session slots: %d/%d\n", dsm_get_num_available_slots(),
                 dsm_get_num_maximum_slots());
+        dsm_stats_t stats;
+        dsm_get_stats(&stats);
+        printf("DTLS handshakes: %" PRIu32 ", requests without handshake: %"
+               PRIu32 ", evicted: %" PRIu32 "\n", stats.handshakes,
+               stats.restored, stats.evicted);
 #endif
         printf(" CLI requests sent: %u\n", req_count);
         printf("CoAP open requests: %u\n", open_reqs);
@@ -77,6 +77,13 @@ PSEUDOMODULES += event_%
 PSEUDOMODULES += event_timeout
 PSEUDOMODULES += event_timeout_ztimer
 PSEUDOMODULES += evtimer_mbox
+
+## @defgroup pseudomodule_evtimer_wheel evtimer_wheel
+## @brief Keep the events of an @ref sys_evtimer in a hashed timing wheel
+##
+## Adding and removing events then takes constant instead of linear time,
+## which pays off with many pending events, e.g. in the NIB of a router.
+PSEUDOMODULES += evtimer_wheel
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fdcan
 PSEUDOMODULES += fmt_%
@@ -115,6 +122,17 @@ PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_ext_frag_stats
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
+
+## @defgroup pseudomodule_gnrc_ipv6_route_cache gnrc_ipv6_route_cache
+## @brief Cache the next hops of forwarded IPv6 packets
+##
+## Packets forwarded to a destination in the cache are sent to the cached
+## next hop right away, reusing their interface header, instead of looking
+## up the next hop in the NIB again. The cache is invalidated whenever the NIB
+## changes.
+## @see CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE
+PSEUDOMODULES += gnrc_ipv6_route_cache
+
 PSEUDOMODULES += gnrc_ipv6_nib_6lbr
 PSEUDOMODULES += gnrc_ipv6_nib_6ln
 PSEUDOMODULES += gnrc_ipv6_nib_6lr
@@ -134,6 +152,15 @@ PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
 
+## @defgroup pseudomodule_gnrc_netif_ipv6_hash gnrc_netif_ipv6_hash
+## @brief Index the IPv6 addresses of all GNRC network interfaces in a hash table
+##
+## Looking up the interface of an address, e.g. to decide whether a received
+## packet is for this node, then takes constant time instead of searching
+## all addresses and multicast groups of all interfaces.
+## @see CONFIG_GNRC_NETIF_IPV6_HASH_SIZE
+PSEUDOMODULES += gnrc_netif_ipv6_hash
+
 
 ## @addtogroup 	net_gnrc_nettype
 ## @{
@@ -255,8 +282,18 @@ PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
 PSEUDOMODULES += gnrc_txtsnd
+## @addtogroup sys_hashes_sha2xx_common
+## @{
+## Use the SHA-NI / ARMv8 crypto extension block transform for SHA-224/256
+PSEUDOMODULES += hashes_sha2xx_accel
+## @}
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
+## @addtogroup net_ieee802154_submac
+## @{
+## Queue one frame behind the current transmission of the SubMAC
+PSEUDOMODULES += ieee802154_submac_pipeline
+## @}
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 PSEUDOMODULES += l2filter_blacklist
@@ -274,6 +311,12 @@ PSEUDOMODULES += lwext4_vfs_format
 ##
 PSEUDOMODULES += libc_gettimeofday
 
+## @defgroup pseudomodule_malloc_thread_safe_cache malloc_thread_safe_cache
+## @brief Per-thread caches of small blocks in front of malloc_thread_safe
+##
+## See @ref sys_malloc_ts for details.
+PSEUDOMODULES += malloc_thread_safe_cache
+
 ## @defgroup pseudomodule_mpu_stack_guard mpu_stack_guard
 ## @brief MPU based stack guard
 ##
@@ -320,6 +363,7 @@ PSEUDOMODULES += netstats_neighbor_count
 PSEUDOMODULES += netstats_neighbor_rssi
 PSEUDOMODULES += netstats_neighbor_lqi
 PSEUDOMODULES += netstats_neighbor_tx_time
+PSEUDOMODULES += netstats_neighbor_tx_hist
 PSEUDOMODULES += netstats_ipv6
 PSEUDOMODULES += netstats_rpl
 PSEUDOMODULES += nimble
@@ -374,9 +418,11 @@ PSEUDOMODULES += saul_gpio
 PSEUDOMODULES += saul_nrf_temperature
 PSEUDOMODULES += saul_nrf_vddh
 PSEUDOMODULES += saul_pwm
+PSEUDOMODULES += saul_reg_index
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += schedstatistics_profile
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -448,6 +494,7 @@ PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
 PSEUDOMODULES += shell_cmd_rtt
 PSEUDOMODULES += shell_cmd_saul_reg
+PSEUDOMODULES += shell_cmd_schedstatistics
 PSEUDOMODULES += shell_cmd_semtech-loramac
 PSEUDOMODULES += shell_cmd_sha1sum
 PSEUDOMODULES += shell_cmd_sha256sum
@@ -510,6 +557,10 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+PSEUDOMODULES += trace_msg
+PSEUDOMODULES += trace_mutex
+PSEUDOMODULES += trace_netif
+PSEUDOMODULES += trace_sched
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
@@ -532,6 +583,14 @@ PSEUDOMODULES += vfs_auto_format
 ## some boards if the @ref pseudomodule_vfs_default module is active.
 PSEUDOMODULES += vfs_auto_mount
 
+## @defgroup pseudomodule_vfs_buffered vfs_buffered
+## @brief Allow buffering reads and writes of open files
+##
+## When this module is active, @ref vfs_setvbuf can be used to attach a
+## buffer to an open file, so small reads and writes are collected into
+## fewer calls to the file system driver.
+PSEUDOMODULES += vfs_buffered
+
 ## @defgroup pseudomodule_vfs_default vfs_default
 ## @brief Enable default assignments of a board's devices to VFS mount points
 ##
@@ -80,6 +80,11 @@ ifneq (,$(filter stdio_uart_rx,$(USEMODULE)))
   USEMODULE += stdio_available
 endif
 
+ifneq (,$(filter stdio_tx_async,$(USEMODULE)))
+  USEMODULE += core_thread_flags
+  USEMODULE += tsrb
+endif
+
 ifneq (,$(filter stdio_uart,$(USEMODULE)))
   FEATURES_REQUIRED_ANY += periph_uart|periph_lpuart
 endif
@@ -29,6 +29,7 @@
 #include "lwip/netif.h"
 #include "lwip/tcp.h"
 #include "lwip/netif.h"
+#include "lwip/udp.h"
 #include "lwip/opt.h"
 
 #include "sock_types.h"
@@ -609,6 +610,21 @@ int lwip_sock_recv(struct netconn *conn, uint32_t timeout, struct netbuf **buf)
 }
 #endif /* defined(MODULE_LWIP_SOCK_UDP) || defined(MODULE_LWIP_SOCK_IP) */
 
+static int _send_err_to_errno(err_t err)
+{
+    switch (err) {
+    case ERR_BUF:
+    case ERR_MEM:
+        return -ENOMEM;
+    case ERR_RTE:
+    case ERR_IF:
+        return -EHOSTUNREACH;
+    case ERR_VAL:
+    default:
+        return -EINVAL;
+    }
+}
+
 ssize_t lwip_sock_sendv(struct netconn *conn, const iolist_t *snips,
                         int proto, const struct _sock_tl_ep *remote, int type)
 {
@@ -705,21 +721,8 @@ ssize_t lwip_sock_sendv(struct netconn *conn, const iolist_t *snips,
         err = netconn_send(tmp, buf);
     }
 
-    switch (err) {
-    case ERR_OK:
-        break;
-    case ERR_BUF:
-    case ERR_MEM:
-        res = -ENOMEM;
-        break;
-    case ERR_RTE:
-    case ERR_IF:
-        res = -EHOSTUNREACH;
-        break;
-    case ERR_VAL:
-    default:
-        res = -EINVAL;
-        break;
+    if (err != ERR_OK) {
+        res = _send_err_to_errno(err);
     }
 
     netbuf_delete(buf);
@@ -731,4 +734,97 @@ ssize_t lwip_sock_sendv(struct netconn *conn, const iolist_t *snips,
     return res;
 }
 
+#ifdef MODULE_LWIP_SOCK_UDP
+/* must be called with the TCP/IP core locked */
+static int _udp_send_locked(struct netconn *conn, uint16_t netif,
+                            const sock_udp_msg_t *msg)
+{
+    ip_addr_t remote_addr;
+    u16_t remote_port = 0;
+    size_t payload_len = 0;
+    struct pbuf *p;
+    err_t err;
+
+    if (msg->remote != NULL) {
+        int type = NETCONN_UDP;
+        int res;
+
+        if (msg->remote->port == 0) {
+            return -EINVAL;
+        }
+        if ((msg->remote->netif != SOCK_ADDR_ANY_NETIF)
+                && (netif != SOCK_ADDR_ANY_NETIF)
+                && (msg->remote->netif != netif)) {
+            return -EINVAL;
+        }
+        if ((res = _sock_ep_to_netconn_pars(NULL,
+                                            (struct _sock_tl_ep *)msg->remote,
+                                            NULL, NULL, &remote_addr,
+                                            &remote_port, &type)) < 0) {
+            return res;
+        }
+    }
+
+    p = pbuf_alloc(PBUF_TRANSPORT, iolist_size(msg->snips), PBUF_RAM);
+    if (p == NULL) {
+        return -ENOMEM;
+    }
+    for (const iolist_t *snip = msg->snips; snip != NULL; snip = snip->iol_next) {
+        if (pbuf_take_at(p, snip->iol_base, snip->iol_len, payload_len) != ERR_OK) {
+            pbuf_free(p);
+            return -ENOMEM;
+        }
+        payload_len += snip->iol_len;
+    }
+
+    if (msg->remote != NULL) {
+        err = udp_sendto(conn->pcb.udp, p, &remote_addr, remote_port);
+    }
+    else {
+        err = udp_send(conn->pcb.udp, p);
+    }
+    pbuf_free(p);
+
+    return (err == ERR_OK) ? (int)payload_len : _send_err_to_errno(err);
+}
+
+int lwip_sock_udp_send_many(struct netconn *conn, sock_udp_msg_t *msgs,
+                            unsigned num)
+{
+    uint16_t netif = SOCK_ADDR_ANY_NETIF;
+    ip_addr_t addr;
+    u16_t port;
+    int res = 0;
+    unsigned i;
+
+    if (conn == NULL) {
+        return -ENOTCONN;
+    }
+    for (i = 0; i < num; i++) {
+        if ((msgs[i].remote != NULL) &&
+            (msgs[i].remote->netif != SOCK_ADDR_ANY_NETIF)) {
+            /* these lock the core themselves, so get the interface of the
+             * local end point before locking it */
+            if (netconn_getaddr(conn, &addr, &port, 1) == 0) {
+                netif = lwip_sock_bind_addr_to_netif(&addr);
+            }
+            break;
+        }
+    }
+
+    /* lock the core once for all datagrams, instead of allocating a netbuf
+     * and locking the core for each one as netconn_send() does */
+    LOCK_TCPIP_CORE();
+    for (i = 0; i < num; i++) {
+        if ((res = _udp_send_locked(conn, netif, &msgs[i])) < 0) {
+            break;
+        }
+        msgs[i].len = res;
+    }
+    UNLOCK_TCPIP_CORE();
+
+    return ((i == 0) && (res < 0)) ? res : (int)i;
+}
+#endif /* MODULE_LWIP_SOCK_UDP */
+
 /** @} */
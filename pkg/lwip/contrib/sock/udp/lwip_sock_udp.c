@@ -197,6 +197,68 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+int sock_udp_send_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num)
+{
+    assert((sock != NULL) && ((msgs != NULL) || (num == 0)));
+    return lwip_sock_udp_send_many(sock->base.conn, msgs, num);
+}
+
+static ssize_t _copy_to_snips(const iolist_t *snips, const struct pbuf *p)
+{
+    u16_t offset = 0;
+
+    if (iolist_size(snips) < p->tot_len) {
+        return -ENOBUFS;
+    }
+    for (; offset < p->tot_len; snips = snips->iol_next) {
+        u16_t chunk = p->tot_len - offset;
+
+        if (snips->iol_len < chunk) {
+            chunk = snips->iol_len;
+        }
+        offset += pbuf_copy_partial(p, snips->iol_base, chunk, offset);
+    }
+    return offset;
+}
+
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        void *data = NULL, *ctx = NULL;
+        ssize_t res;
+
+        if (i > 0) {
+            msg_t msg = { .content = { .ptr = NULL } };
+            const struct netbuf *buf;
+
+            /* only take datagrams that are already in the receive mailbox of
+             * the netconn and leave one that does not fit to the next call */
+            mbox_peek(&sock->base.conn->recvmbox.mbox, &msg);
+            buf = msg.content.ptr;
+            if ((buf == NULL) || (buf->p->tot_len > iolist_size(msgs[i].snips))) {
+                break;
+            }
+        }
+        res = sock_udp_recv_buf_aux(sock, &data, &ctx, (i == 0) ? timeout : 0,
+                                    msgs[i].remote, NULL);
+        if (ctx != NULL) {
+            struct netbuf *buf = ctx;
+
+            res = _copy_to_snips(msgs[i].snips, buf->p);
+            netbuf_delete(buf);
+        }
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+        msgs[i].len = res;
+    }
+    return i;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
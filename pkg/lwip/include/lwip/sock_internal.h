@@ -27,6 +27,9 @@
 
 #include "net/af.h"
 #include "net/sock.h"
+#if defined(MODULE_LWIP_SOCK_UDP)
+#include "net/sock/udp.h"
+#endif
 
 #include "lwip/ip_addr.h"
 #include "lwip/api.h"
@@ -69,6 +72,10 @@ static inline ssize_t lwip_sock_send(struct netconn *conn,
 
     return lwip_sock_sendv(conn, &snip, proto, remote, type);
 }
+#if defined(MODULE_LWIP_SOCK_UDP)
+int lwip_sock_udp_send_many(struct netconn *conn, sock_udp_msg_t *msgs,
+                            unsigned num);
+#endif
 /** @internal
  * @}
  */
@@ -233,40 +233,24 @@ static int _get_psk_info(struct dtls_context_t *ctx, const session_t *session,
         }
 
         /* if no callback set or no valid credential returned, try to find a valid registered one */
+        if (!c && desc &&
+            (credman_get_psk_by_hint(&credential, sock->tags, sock->tags_len,
+                                     desc, desc_len) == CREDMAN_OK)) {
+            c = credential.params.psk.id.s;
+            c_len = credential.params.psk.id.len;
+        }
+
+        /* if no credential so far, fallback to the first valid one, return alert otherwise */
         DEBUG("sock_dtls: trying to get first PSK credential\n");
-        credman_credential_t first = { .tag = CREDMAN_TAG_EMPTY };
         for (unsigned i = 0; i < sock->tags_len && !c; i++) {
             if (credman_get(&credential, sock->tags[i], CREDMAN_TYPE_PSK) == CREDMAN_OK) {
-                /* if no hint was provided, settle for the first valid credential */
-                if (!desc) {
-                    c = credential.params.psk.id.s;
-                    c_len = credential.params.psk.id.len;
-                    break;
-                }
-
-                /* save the first valid one in case we don't find the hint */
-                if (first.tag == CREDMAN_TAG_EMPTY) {
-                    memcpy(&first, &credential, sizeof(credman_credential_t));
-                }
-
-                if (desc_len == credential.params.psk.hint.len &&
-                    !strncmp(credential.params.psk.hint.s, (const char *)desc, desc_len)) {
-                    c = credential.params.psk.id.s;
-                    c_len = credential.params.psk.id.len;
-                }
+                c = credential.params.psk.id.s;
+                c_len = credential.params.psk.id.len;
             }
         }
-
-        /* if no credential so far, fallback to the first valid one, return alert otherwise */
         if (!c) {
-            if (first.tag != CREDMAN_TAG_EMPTY) {
-                c = first.params.psk.id.s;
-                c_len = first.params.psk.id.len;
-            }
-            else {
-                DEBUG("sock_dtls: could not find a valid PSK credential\n");
-                return dtls_alert_fatal_create(DTLS_ALERT_INTERNAL_ERROR);
-            }
+            DEBUG("sock_dtls: could not find a valid PSK credential\n");
+            return dtls_alert_fatal_create(DTLS_ALERT_INTERNAL_ERROR);
         }
         break;
     case DTLS_PSK_KEY:
@@ -275,19 +259,11 @@ static int _get_psk_info(struct dtls_context_t *ctx, const session_t *session,
         if (desc) {
             DEBUG("sock_dtls: looking for key for ID: %.*s\n", (unsigned)desc_len, desc);
             /* try to find matching ID among the registered credentials */
-            for (unsigned i = 0; i < sock->tags_len; i++) {
-                if (credman_get(&credential, sock->tags[i], CREDMAN_TYPE_PSK) == CREDMAN_OK) {
-                    DEBUG("sock_dtls: comparing to tag %d, with ID: %.*s\n", sock->tags[i],
-                          (unsigned)credential.params.psk.id.len,
-                          (char *)credential.params.psk.id.s);
-                    if (desc_len == credential.params.psk.id.len &&
-                        !memcmp(desc, credential.params.psk.id.s, desc_len)) {
-                        DEBUG("sock_dtls: found\n");
-                        c = credential.params.psk.key.s;
-                        c_len = credential.params.psk.key.len;
-                        break;
-                    }
-                }
+            if (credman_get_psk_by_id(&credential, sock->tags, sock->tags_len,
+                                      desc, desc_len) == CREDMAN_OK) {
+                DEBUG("sock_dtls: found tag %d\n", credential.tag);
+                c = credential.params.psk.key.s;
+                c_len = credential.params.psk.key.len;
             }
         }
         break;
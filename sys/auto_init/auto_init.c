@@ -40,6 +40,11 @@ static inline void _auto_init_module(const volatile auto_init_module_t *module)
     module->init();
 }
 
+#if IS_USED(MODULE_STDIO_TX_ASYNC)
+extern void auto_init_stdio_tx_async(void);
+AUTO_INIT(auto_init_stdio_tx_async,
+          AUTO_INIT_PRIO_MOD_STDIO_TX_ASYNC);
+#endif
 #if IS_USED(MODULE_AUTO_INIT_ZTIMER)
 extern void ztimer_init(void);
 AUTO_INIT(ztimer_init,
@@ -65,6 +70,11 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_TRACE)
+extern void auto_init_trace(void);
+AUTO_INIT(auto_init_trace,
+          AUTO_INIT_PRIO_MOD_TRACE);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
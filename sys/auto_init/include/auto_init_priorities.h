@@ -22,6 +22,12 @@
 extern "C" {
 #endif
 
+#ifndef AUTO_INIT_PRIO_MOD_STDIO_TX_ASYNC
+/**
+ * @brief   buffered STDIO output priority
+ */
+#define AUTO_INIT_PRIO_MOD_STDIO_TX_ASYNC               1005
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_ZTIMER
 /**
  * @brief   ztimer priority
@@ -58,6 +64,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE
+/**
+ * @brief   tracing priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE                        1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -60,16 +60,6 @@
 #  define AES_KEY_SIZE(ctx) ctx->key_size
 #endif
 
-/**
- * @brief AES key
- * @see cipher_context_t
- */
-typedef struct {
-    /** @cond INTERNAL */
-    uint32_t rd_key[4 * (AES_MAXNR + 1)];
-    int rounds;
-    /** @endcond */
-} aes_key_t;
 /**
  * Interface to the aes cipher
  */
@@ -1060,6 +1050,22 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
     return 0;
 }
 
+int aes_init_key_schedule(aes_key_t *key, const uint8_t *user_key,
+                          uint8_t key_size)
+{
+    if ((key_size == AES_KEY_SIZE_128 && !IS_USED(MODULE_CRYPTO_AES_128)) ||
+        (key_size == AES_KEY_SIZE_192 && !IS_USED(MODULE_CRYPTO_AES_192)) ||
+        (key_size == AES_KEY_SIZE_256 && !IS_USED(MODULE_CRYPTO_AES_256))) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    if (aes_set_encrypt_key(user_key, key_size * 8, key) < 0) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    return CIPHER_INIT_SUCCESS;
+}
+
 #ifndef AES_ASM
 /*
  * Encrypt a single block
@@ -1071,7 +1077,6 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
     /* setup AES_KEY */
     int res;
     aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
 
     res = aes_set_encrypt_key((unsigned char *)context->context,
                               AES_KEY_SIZE(context) * 8, &aeskey);
@@ -1079,6 +1084,13 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         return res;
     }
 
+    aes_encrypt_key_schedule(&aeskey, plainBlock, cipherBlock);
+    return 1;
+}
+
+void aes_encrypt_key_schedule(const aes_key_t *key, const uint8_t *plainBlock,
+                              uint8_t *cipherBlock)
+{
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1327,7 +1339,6 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
 /*
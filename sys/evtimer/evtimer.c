@@ -22,6 +22,9 @@
  * @}
  */
 
+#include <assert.h>
+#include <string.h>
+
 #include "div.h"
 #include "irq.h"
 
@@ -30,6 +33,245 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_EVTIMER_WHEEL)
+
+#define WHEEL_MASK  (CONFIG_EVTIMER_WHEEL_SLOTS - 1)
+
+static_assert((CONFIG_EVTIMER_WHEEL_SLOTS & WHEEL_MASK) == 0,
+              "CONFIG_EVTIMER_WHEEL_SLOTS must be a power of two");
+
+/*
+ * The wheel has been processed up to evtimer->base. A pending event is kept in
+ * the slot of its absolute expiry time (stored in event->offset), which lies
+ * after evtimer->base. Slots are lists with the most recently added event
+ * first. Whenever the timer expires, all slots between evtimer->base and now
+ * are searched for the events that expired. evtimer->next holds the distance
+ * from evtimer->base to the earliest event, so the timer only expires when an
+ * event is due, however many revolutions ahead. Removing an event leaves the
+ * timer alone, it expiring early just finds no events.
+ */
+
+static evtimer_event_t **_slot(evtimer_t *evtimer, uint32_t time)
+{
+    return &evtimer->slots[time & WHEEL_MASK];
+}
+
+static void _set_timer(evtimer_t *evtimer, uint32_t now)
+{
+    uint32_t elapsed = now - evtimer->base;
+
+    if (evtimer->next) {
+        DEBUG("evtimer: now=%" PRIu32 " ms setting ztimer to %" PRIu32 " ms\n",
+              now, evtimer->base + evtimer->next);
+        ztimer_set(ZTIMER_MSEC, &evtimer->timer,
+                   (evtimer->next > elapsed) ? evtimer->next - elapsed : 0);
+    }
+    else {
+        ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
+    }
+}
+
+static void _update_next(evtimer_t *evtimer)
+{
+    evtimer->next = 0;
+    for (unsigned i = 1; i <= CONFIG_EVTIMER_WHEEL_SLOTS; i++) {
+        for (evtimer_event_t *event = *_slot(evtimer, evtimer->base + i);
+             event; event = event->next) {
+            uint32_t ticks = event->offset - evtimer->base;
+            if (!evtimer->next || (ticks < evtimer->next)) {
+                evtimer->next = ticks;
+            }
+        }
+        /* the events in the following slots are at least i + 1 ticks away */
+        if (evtimer->next && (evtimer->next <= i)) {
+            break;
+        }
+    }
+}
+
+void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    DEBUG("evtimer_add(): adding event with offset %" PRIu32 "\n", event->offset);
+
+    if (!evtimer->next) {
+        /* the wheel is idle, so it can skip ahead */
+        evtimer->base = now;
+    }
+
+    uint32_t elapsed = now - evtimer->base;
+    /* one tick of headroom for stepping back evtimer->base below */
+    uint32_t ticks = (event->offset < UINT32_MAX - 1 - elapsed)
+                   ? event->offset + elapsed : UINT32_MAX - 1;
+    if (ticks == 0) {
+        /* the event is due, but the slot of evtimer->base was processed
+         * already: step back one tick, so the timer expires right away */
+        evtimer->base--;
+        if (evtimer->next) {
+            evtimer->next++;
+        }
+        ticks = 1;
+    }
+    event->offset = evtimer->base + ticks;
+
+    evtimer_event_t **slot = _slot(evtimer, event->offset);
+    event->next = *slot;
+    *slot = event;
+
+    if (!evtimer->next || (ticks < evtimer->next)) {
+        evtimer->next = ticks;
+        _set_timer(evtimer, now);
+    }
+    irq_restore(state);
+    if (sched_context_switch_request) {
+        thread_yield_higher();
+    }
+}
+
+static bool _del_event_from_slot(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    evtimer_event_t **list = _slot(evtimer, event->offset);
+
+    while (*list) {
+        if (*list == event) {
+            *list = event->next;
+            return true;
+        }
+        list = &(*list)->next;
+    }
+    return false;
+}
+
+void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_del(): removing event with offset %" PRIu32 "\n", event->offset);
+
+    /* the timer is left alone, it expiring early is handled like a slot only
+     * holding events for a later revolution */
+    _del_event_from_slot(evtimer, event);
+    irq_restore(state);
+}
+
+static void _evtimer_handler(void *arg)
+{
+    DEBUG("_evtimer_handler()\n");
+
+    evtimer_t *evtimer = (evtimer_t *)arg;
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t elapsed = now - evtimer->base;
+    unsigned slots = (elapsed < CONFIG_EVTIMER_WHEEL_SLOTS)
+                   ? elapsed : CONFIG_EVTIMER_WHEEL_SLOTS;
+    evtimer_event_t *expired = NULL;
+    evtimer_event_t **tail = &expired;
+
+    /* collect the expired events in order */
+    for (unsigned i = 1; i <= slots; i++) {
+        evtimer_event_t **list = _slot(evtimer, evtimer->base + i);
+        evtimer_event_t *reversed = NULL;
+
+        while (*list) {
+            evtimer_event_t *event = *list;
+            /* expired if it lies within (evtimer->base, now] */
+            if (event->offset - evtimer->base - 1 < elapsed) {
+                *list = event->next;
+                event->next = reversed;
+                reversed = event;
+            }
+            else {
+                list = &event->next;
+            }
+        }
+        while (reversed) {
+            *tail = reversed;
+            tail = &reversed->next;
+            reversed = reversed->next;
+        }
+        *tail = NULL;
+    }
+    evtimer->base = now;
+
+    while (expired) {
+        evtimer_event_t *event = expired;
+        expired = event->next;
+        event->offset = 0;
+        evtimer->callback(event);
+    }
+
+    _update_next(evtimer);
+    _set_timer(evtimer, ztimer_now(ZTIMER_MSEC));
+}
+
+void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
+{
+    evtimer->callback = handler;
+    evtimer->timer.callback = _evtimer_handler;
+    evtimer->timer.arg = (void *)evtimer;
+    evtimer->next = 0;
+    memset(evtimer->slots, 0, sizeof(evtimer->slots));
+}
+
+bool evtimer_is_set(const evtimer_t *evtimer, const evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+    evtimer_event_t *list = evtimer->slots[event->offset & WHEEL_MASK];
+
+    while (list && (list != event)) {
+        list = list->next;
+    }
+    irq_restore(state);
+    return list != NULL;
+}
+
+evtimer_event_t *evtimer_find(const evtimer_t *evtimer, evtimer_filter_t filter,
+                              const void *arg, uint32_t *remaining)
+{
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    evtimer_event_t *found = NULL;
+    uint32_t ticks = UINT32_MAX;
+
+    for (unsigned i = 0; i < CONFIG_EVTIMER_WHEEL_SLOTS; i++) {
+        for (evtimer_event_t *event = evtimer->slots[i]; event;
+             event = event->next) {
+            uint32_t event_ticks = event->offset - evtimer->base;
+            /* <= keeps the first added of the events expiring at once */
+            if ((event_ticks <= ticks) &&
+                ((filter == NULL) || filter(event, arg))) {
+                found = event;
+                ticks = event_ticks;
+            }
+        }
+    }
+    if (found && remaining) {
+        uint32_t elapsed = now - evtimer->base;
+        *remaining = (ticks > elapsed) ? ticks - elapsed : 0;
+    }
+    irq_restore(state);
+    return found;
+}
+
+void evtimer_print(const evtimer_t *evtimer)
+{
+    int nr = 0;
+
+    for (unsigned i = 1; i <= CONFIG_EVTIMER_WHEEL_SLOTS; i++) {
+        evtimer_event_t *list = evtimer->slots[(evtimer->base + i) & WHEEL_MASK];
+
+        while (list) {
+            nr++;
+            printf("ev #%d slot=%u expires=%u\n", nr,
+                   (evtimer->base + i) & WHEEL_MASK, (unsigned)list->offset);
+            list = list->next;
+        }
+    }
+}
+
+#else /* MODULE_EVTIMER_WHEEL */
+
 static void _add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
 {
     DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
@@ -192,6 +434,40 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
     evtimer->events = NULL;
 }
 
+bool evtimer_is_set(const evtimer_t *evtimer, const evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+    evtimer_event_t *list = evtimer->events;
+
+    while (list && (list != event)) {
+        list = list->next;
+    }
+    irq_restore(state);
+    return list != NULL;
+}
+
+evtimer_event_t *evtimer_find(const evtimer_t *evtimer, evtimer_filter_t filter,
+                              const void *arg, uint32_t *remaining)
+{
+    unsigned state = irq_disable();
+    evtimer_event_t *list = evtimer->events;
+    uint32_t offset = 0;
+
+    while (list) {
+        offset += list->offset;
+        if ((filter == NULL) || filter(list, arg)) {
+            break;
+        }
+        list = list->next;
+    }
+    if (list && remaining) {
+        uint32_t elapsed = ztimer_now(ZTIMER_MSEC) - evtimer->base;
+        *remaining = (offset > elapsed) ? offset - elapsed : 0;
+    }
+    irq_restore(state);
+    return list;
+}
+
 void evtimer_print(const evtimer_t *evtimer)
 {
     evtimer_event_t *list = evtimer->events;
@@ -203,3 +479,5 @@ void evtimer_print(const evtimer_t *evtimer)
         list = list->next;
     }
 }
+
+#endif /* MODULE_EVTIMER_WHEEL */
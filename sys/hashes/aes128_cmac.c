@@ -33,7 +33,7 @@ static void _xor128(uint8_t *x, uint8_t *y)
     }
 }
 
-static void _leftshift(uint8_t *x, uint8_t *y)
+static void _leftshift(const uint8_t *x, uint8_t *y)
 {
     for (unsigned i = 0; i < 15; i++) {
         y[i] = (x[i] << 1) | (x[i + 1] >> 7);
@@ -41,6 +41,27 @@ static void _leftshift(uint8_t *x, uint8_t *y)
     y[15] = x[15] << 1;
 }
 
+static void _subkey(const uint8_t *in, uint8_t *out)
+{
+    uint8_t msb = in[0] & 0x80;
+
+    _leftshift(in, out);
+    if (msb) {
+        out[15] ^= 0x87;
+    }
+}
+
+static void _encrypt(const aes128_cmac_context_t *ctx, const uint8_t *in,
+                     uint8_t *out)
+{
+    if (ctx->key) {
+        aes_encrypt_key_schedule(&ctx->key->aes, in, out);
+    }
+    else {
+        cipher_encrypt(&ctx->aes128_ctx, in, out);
+    }
+}
+
 int aes128_cmac_init(aes128_cmac_context_t *ctx,
                      const uint8_t *key, uint8_t key_size)
 {
@@ -52,6 +73,36 @@ int aes128_cmac_init(aes128_cmac_context_t *ctx,
     return cipher_init(&(ctx->aes128_ctx), CIPHER_AES, key, key_size);
 }
 
+int aes128_cmac_key_init(aes128_cmac_key_t *key,
+                         const uint8_t *raw_key, uint8_t key_size)
+{
+    uint8_t L[AES128_CMAC_BLOCK_SIZE] = { 0 };
+
+    if (key_size != AES128_CMAC_BLOCK_SIZE) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+    int res = aes_init_key_schedule(&key->aes, raw_key, key_size);
+    if (res != CIPHER_INIT_SUCCESS) {
+        return res;
+    }
+
+    aes_encrypt_key_schedule(&key->aes, L, L);
+    _subkey(L, key->k1);
+    _subkey(key->k1, key->k2);
+
+    return CIPHER_INIT_SUCCESS;
+}
+
+void aes128_cmac_init_key(aes128_cmac_context_t *ctx,
+                          const aes128_cmac_key_t *key)
+{
+    /* the cipher context is not used, don't bother clearing it */
+    ctx->key = key;
+    memset(ctx->X, 0, sizeof(ctx->X));
+    ctx->M_n = 0;
+}
+
 void aes128_cmac_update(aes128_cmac_context_t *ctx,
                         const void *data, size_t len)
 {
@@ -62,7 +113,7 @@ void aes128_cmac_update(aes128_cmac_context_t *ctx,
         if (ctx->M_n == 16) {
             ctx->M_n = 0;
             _xor128(ctx->M_last, ctx->X);
-            cipher_encrypt(&ctx->aes128_ctx, ctx->X, d);
+            _encrypt(ctx, ctx->X, d);
             memcpy(ctx->X, d, AES128_CMAC_BLOCK_SIZE);
         }
         c = MIN(AES128_CMAC_BLOCK_SIZE - ctx->M_n, len);
@@ -79,36 +130,32 @@ void aes128_cmac_update(aes128_cmac_context_t *ctx,
 
 void aes128_cmac_final(aes128_cmac_context_t *ctx, void *digest)
 {
-    /* Generate subkeys */
     uint8_t K[AES128_CMAC_BLOCK_SIZE];
     uint8_t L[AES128_CMAC_BLOCK_SIZE];
 
-    memset(K, 0, AES128_CMAC_BLOCK_SIZE);
-    cipher_encrypt(&ctx->aes128_ctx, K, L);
-
-    if (L[0] & 0x80) {
-        _leftshift(L, K);
-        K[15] ^= 0x87;
+    if (ctx->key) {
+        memcpy(K, (ctx->M_n != 16) ? ctx->key->k2 : ctx->key->k1,
+               AES128_CMAC_BLOCK_SIZE);
     }
     else {
-        _leftshift(L, K);
+        /* Generate subkeys */
+        memset(K, 0, AES128_CMAC_BLOCK_SIZE);
+        cipher_encrypt(&ctx->aes128_ctx, K, L);
+        _subkey(L, K);
+
+        if (ctx->M_n != 16) {
+            /* Generate K2 */
+            _subkey(K, K);
+        }
     }
 
     if (ctx->M_n != 16) {
-        /* Generate K2 */
-        if (K[0] & 0x80) {
-            _leftshift(K, K);
-            K[15] ^= 0x87;
-        }
-        else {
-            _leftshift(K, K);
-        }
         /* Padding */
         memset(ctx->M_last + ctx->M_n, 0, AES128_CMAC_BLOCK_SIZE - ctx->M_n);
         ctx->M_last[ctx->M_n] = 0x80;
     }
     _xor128(K, ctx->M_last);
     _xor128(ctx->M_last, ctx->X);
-    cipher_encrypt(&ctx->aes128_ctx, ctx->X, L);
+    _encrypt(ctx, ctx->X, L);
     memcpy(digest, L, AES128_CMAC_BLOCK_SIZE);
 }
@@ -78,6 +78,31 @@ void sha256(const void *data, size_t len, void *digest)
     sha256_final(&c, digest);
 }
 
+void sha256_multi(const void *const data[], const size_t len[], unsigned n,
+                  void *const digest[])
+{
+    sha256_context_t c[SHA2XX_MULTI_LANES];
+    sha256_context_t *cp[SHA2XX_MULTI_LANES];
+
+    for (unsigned base = 0; base < n; base += SHA2XX_MULTI_LANES) {
+        unsigned lanes = n - base;
+
+        if (lanes > SHA2XX_MULTI_LANES) {
+            lanes = SHA2XX_MULTI_LANES;
+        }
+
+        for (unsigned l = 0; l < lanes; l++) {
+            sha256_init(&c[l]);
+            cp[l] = &c[l];
+        }
+        sha2xx_update_multi(cp, &data[base], &len[base], lanes);
+        for (unsigned l = 0; l < lanes; l++) {
+            assert(digest[base + l]);
+            sha256_final(&c[l], digest[base + l]);
+        }
+    }
+}
+
 void hmac_sha256_init(hmac_context_t *ctx, const void *key, size_t key_length)
 {
     unsigned char k[SHA256_INTERNAL_BLOCK_SIZE];
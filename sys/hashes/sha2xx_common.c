@@ -47,9 +47,22 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_HASHES_SHA2XX_ACCEL)
+#  if defined(__x86_64__) || defined(__i386__)
+#    include <cpuid.h>
+#    include <immintrin.h>
+#    define SHA2XX_ACCEL_X86    1
+#  elif defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+#    include <arm_neon.h>
+#    define SHA2XX_ACCEL_ARMV8  1
+#  endif
+#endif
 
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -168,6 +181,245 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
     }
 }
 
+/*
+ * Big-endian load of one message word, used by the multi-buffer transform
+ * which reads the input blocks in place instead of copying them into W.
+ */
+static inline uint32_t _be32dec(const unsigned char *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/**
+ * @brief   One 32 bit word for each of the SHA2XX_MULTI_LANES lanes
+ *
+ * Arithmetic on this type is performed element wise. Targets with SIMD units
+ * process all lanes at once, others get the lanes interleaved, which still
+ * helps superscalar cores.
+ */
+typedef uint32_t sha2xx_lanes_t __attribute__((vector_size(4 * SHA2XX_MULTI_LANES)));
+
+/* One round of the compression function, callers rotate the arguments */
+#define ROUND_LANES(a, b, c, d, e, f, g, h, i) do {                     \
+        sha2xx_lanes_t t0 = h + S1(e) + Ch(e, f, g) + W[(i) & 15] + K[i]; \
+        d += t0;                                                        \
+        h = t0 + S0(a) + Maj(a, b, c);                                  \
+    } while (0)
+
+/*
+ * SHA256 block compression function for SHA2XX_MULTI_LANES independent
+ * states. The message schedule is kept as a rolling 16 word window to bound
+ * stack usage.
+ */
+static void sha2xx_transform_lanes(uint32_t *const state[SHA2XX_MULTI_LANES],
+                                   const unsigned char *const block[SHA2XX_MULTI_LANES])
+{
+    sha2xx_lanes_t W[16] = { 0 };
+    sha2xx_lanes_t S[8] = { 0 };
+
+    for (int i = 0; i < 16; i++) {
+        for (int l = 0; l < SHA2XX_MULTI_LANES; l++) {
+            W[i][l] = _be32dec(&block[l][4 * i]);
+        }
+    }
+
+    for (int j = 0; j < 8; j++) {
+        for (int l = 0; l < SHA2XX_MULTI_LANES; l++) {
+            S[j][l] = state[l][j];
+        }
+    }
+
+    sha2xx_lanes_t a = S[0], b = S[1], c = S[2], d = S[3];
+    sha2xx_lanes_t e = S[4], f = S[5], g = S[6], h = S[7];
+
+    for (int i = 0; i < 64; i += 8) {
+        if (i >= 16) {
+            for (int j = i; j < i + 8; j++) {
+                W[j & 15] += s1(W[(j - 2) & 15]) + W[(j - 7) & 15]
+                           + s0(W[(j - 15) & 15]);
+            }
+        }
+        ROUND_LANES(a, b, c, d, e, f, g, h, i + 0);
+        ROUND_LANES(h, a, b, c, d, e, f, g, i + 1);
+        ROUND_LANES(g, h, a, b, c, d, e, f, i + 2);
+        ROUND_LANES(f, g, h, a, b, c, d, e, i + 3);
+        ROUND_LANES(e, f, g, h, a, b, c, d, i + 4);
+        ROUND_LANES(d, e, f, g, h, a, b, c, i + 5);
+        ROUND_LANES(c, d, e, f, g, h, a, b, i + 6);
+        ROUND_LANES(b, c, d, e, f, g, h, a, i + 7);
+    }
+
+    S[0] += a; S[1] += b; S[2] += c; S[3] += d;
+    S[4] += e; S[5] += f; S[6] += g; S[7] += h;
+
+    for (int j = 0; j < 8; j++) {
+        for (int l = 0; l < SHA2XX_MULTI_LANES; l++) {
+            state[l][j] = S[j][l];
+        }
+    }
+}
+
+#if defined(SHA2XX_ACCEL_X86)
+/*
+ * SHA-NI block compression. The state is kept in the ABEF/CDGH layout the
+ * sha256rnds2 instruction expects and converted back after the last block.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void sha2xx_transform_accel(uint32_t *state, const unsigned char *data,
+                                   size_t nblocks)
+{
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                        0x0405060700010203ULL);
+    __m128i tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);                 /* CDAB */
+    state1 = _mm_shuffle_epi32(state1, 0x1B);           /* EFGH */
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);   /* ABEF */
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);        /* CDGH */
+
+    while (nblocks--) {
+        __m128i abef = state0;
+        __m128i cdgh = state1;
+        __m128i m[4];
+
+        for (unsigned j = 0; j < 16; j++) {
+            __m128i w;
+
+            if (j < 4) {
+                w = _mm_loadu_si128((const __m128i *)&data[16 * j]);
+                w = _mm_shuffle_epi8(w, mask);
+            }
+            else {
+                /* m[j & 3] holds W[4j - 16 .. 4j - 13] at this point */
+                w = _mm_sha256msg1_epu32(m[j & 3], m[(j + 1) & 3]);
+                w = _mm_add_epi32(w, _mm_alignr_epi8(m[(j + 3) & 3],
+                                                     m[(j + 2) & 3], 4));
+                w = _mm_sha256msg2_epu32(w, m[(j + 3) & 3]);
+            }
+            m[j & 3] = w;
+
+            __m128i msg = _mm_add_epi32(w, _mm_loadu_si128((const __m128i *)&K[4 * j]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);              /* FEBA */
+    state1 = _mm_shuffle_epi32(state1, 0xB1);           /* DCHG */
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);        /* DCBA */
+    state1 = _mm_alignr_epi8(state1, tmp, 8);           /* ABEF */
+
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+bool sha2xx_accel_available(void)
+{
+    static int8_t available = -1;
+
+    if (available < 0) {
+        unsigned eax, ebx, ecx, edx;
+        available = 0;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1) &&
+            __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_SHA)) {
+            available = 1;
+        }
+    }
+
+    return available;
+}
+#elif defined(SHA2XX_ACCEL_ARMV8)
+/*
+ * ARMv8 cryptographic extension block compression
+ */
+static void sha2xx_transform_accel(uint32_t *state, const unsigned char *data,
+                                   size_t nblocks)
+{
+    uint32x4_t state0 = vld1q_u32(&state[0]);
+    uint32x4_t state1 = vld1q_u32(&state[4]);
+
+    while (nblocks--) {
+        uint32x4_t abcd = state0;
+        uint32x4_t efgh = state1;
+        uint32x4_t m[4];
+
+        for (unsigned j = 0; j < 4; j++) {
+            m[j] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&data[16 * j])));
+        }
+
+        for (unsigned j = 0; j < 16; j++) {
+            uint32x4_t msg = vaddq_u32(m[j & 3], vld1q_u32(&K[4 * j]));
+            uint32x4_t tmp = state0;
+
+            if (j < 12) {
+                m[j & 3] = vsha256su1q_u32(vsha256su0q_u32(m[j & 3], m[(j + 1) & 3]),
+                                           m[(j + 2) & 3], m[(j + 3) & 3]);
+            }
+            state0 = vsha256hq_u32(state0, state1, msg);
+            state1 = vsha256h2q_u32(state1, tmp, msg);
+        }
+
+        state0 = vaddq_u32(state0, abcd);
+        state1 = vaddq_u32(state1, efgh);
+        data += 64;
+    }
+
+    vst1q_u32(&state[0], state0);
+    vst1q_u32(&state[4], state1);
+}
+
+bool sha2xx_accel_available(void)
+{
+    return true;
+}
+#else
+bool sha2xx_accel_available(void)
+{
+    return false;
+}
+#endif
+
+/*
+ * Compress @p nblocks consecutive 64 byte blocks into @p state, using the
+ * hardware transform if there is one.
+ */
+static void sha2xx_transform_blocks(uint32_t *state, const unsigned char *data,
+                                    size_t nblocks)
+{
+#if defined(SHA2XX_ACCEL_X86) || defined(SHA2XX_ACCEL_ARMV8)
+    if (sha2xx_accel_available()) {
+        sha2xx_transform_accel(state, data, nblocks);
+        return;
+    }
+#endif
+    while (nblocks--) {
+        sha2xx_transform(state, data);
+        data += 64;
+    }
+}
+
+/* Update the bit counter by len bytes */
+static void sha2xx_count(sha2xx_context_t *ctx, size_t len)
+{
+    /* Convert the length into a number of bits */
+    uint32_t bitlen1 = ((uint32_t) len) << 3;
+    uint32_t bitlen0 = ((uint32_t) len) >> 29;
+
+    /* Update number of bits */
+    if ((ctx->count[1] += bitlen1) < bitlen1) {
+        ctx->count[0]++;
+    }
+
+    ctx->count[0] += bitlen0;
+}
+
 static const unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -203,16 +455,7 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     /* Number of bytes free in the buffer from previous updates */
     uint8_t f = 64 - r;
 
-    /* Convert the length into a number of bits */
-    uint32_t bitlen1 = ((uint32_t) len) << 3;
-    uint32_t bitlen0 = ((uint32_t) len) >> 29;
-
-    /* Update number of bits */
-    if ((ctx->count[1] += bitlen1) < bitlen1) {
-        ctx->count[0]++;
-    }
-
-    ctx->count[0] += bitlen0;
+    sha2xx_count(ctx, len);
 
     /* Handle the case where we don't need to perform any transforms */
     if (len < f) {
@@ -226,21 +469,106 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, f);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
     src += f;
     len -= f;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
-    }
+    sha2xx_transform_blocks(ctx->state, src, len / 64);
+    src += len & ~(size_t)0x3f;
+    len &= 0x3f;
 
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
 }
 
+/* Add bytes of several independent messages into their hashes */
+void sha2xx_update_multi(sha2xx_context_t *const ctx[],
+                         const void *const data[], const size_t len[],
+                         unsigned n)
+{
+    if (sha2xx_accel_available()) {
+        /* the hardware transform beats the interleaved software one */
+        for (unsigned i = 0; i < n; i++) {
+            sha2xx_update(ctx[i], data[i], len[i]);
+        }
+        return;
+    }
+
+    for (unsigned base = 0; base < n; base += SHA2XX_MULTI_LANES) {
+        const unsigned char *src[SHA2XX_MULTI_LANES];
+        size_t blocks[SHA2XX_MULTI_LANES];
+        size_t tail[SHA2XX_MULTI_LANES];
+        unsigned lanes = n - base;
+
+        if (lanes > SHA2XX_MULTI_LANES) {
+            lanes = SHA2XX_MULTI_LANES;
+        }
+
+        /* Fill up partially filled buffers first, so that the remainder of
+         * every message starts on a block boundary */
+        for (unsigned l = 0; l < lanes; l++) {
+            sha2xx_context_t *c = ctx[base + l];
+            size_t head = (64 - ((c->count[1] >> 3) & 0x3f)) & 0x3f;
+
+            if (head > len[base + l]) {
+                head = len[base + l];
+            }
+            sha2xx_update(c, data[base + l], head);
+            src[l] = (const unsigned char *)data[base + l] + head;
+            blocks[l] = (len[base + l] - head) / 64;
+            tail[l] = (len[base + l] - head) % 64;
+            sha2xx_count(c, len[base + l] - head);
+        }
+
+        /* Compress all lanes that still have full blocks in lockstep,
+         * lanes that ran dry compress into a scratch state */
+        while (1) {
+            uint32_t scratch[8] = { 0 };
+            uint32_t *state[SHA2XX_MULTI_LANES];
+            const unsigned char *block[SHA2XX_MULTI_LANES];
+            unsigned active = 0;
+            unsigned last = 0;
+
+            for (unsigned l = 0; l < lanes; l++) {
+                if (blocks[l]) {
+                    active++;
+                    last = l;
+                }
+            }
+
+            if (active <= 1) {
+                if (active) {
+                    sha2xx_transform_blocks(ctx[base + last]->state, src[last],
+                                            blocks[last]);
+                    src[last] += blocks[last] * 64;
+                }
+                break;
+            }
+
+            const unsigned char *filler = src[last];
+            for (unsigned l = 0; l < SHA2XX_MULTI_LANES; l++) {
+                if ((l < lanes) && blocks[l]) {
+                    state[l] = ctx[base + l]->state;
+                    block[l] = src[l];
+                    src[l] += 64;
+                    blocks[l]--;
+                }
+                else {
+                    state[l] = scratch;
+                    block[l] = filler;
+                }
+            }
+            sha2xx_transform_lanes(state, block);
+        }
+
+        /* Buffer whatever is left, the bits were already counted */
+        for (unsigned l = 0; l < lanes; l++) {
+            memcpy(ctx[base + l]->buf, src[l], tail[l]);
+        }
+    }
+}
+
 /*
  * SHA-224 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
@@ -67,6 +67,19 @@ typedef struct {
     uint32_t context[(4 * (AES_MAXNR + 1)) + 1];
 } aes_context_t;
 
+/**
+ * @brief   Expanded AES encryption key
+ *
+ * @ref aes_encrypt expands the key for every block, keep the expanded key
+ * around if the same key encrypts many blocks.
+ */
+typedef struct {
+    /** @cond INTERNAL */
+    uint32_t rd_key[4 * (AES_MAXNR + 1)];
+    int rounds;
+    /** @endcond */
+} aes_key_t;
+
 /**
  * @brief   initializes the AES Cipher-algorithm with the passed parameters
  *
@@ -104,6 +117,33 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   Expands @p user_key into the encryption key schedule @p key
+ *
+ * @param[out]  key         the expanded key
+ * @param[in]   user_key    the key to expand
+ * @param[in]   key_size    the size of @p user_key
+ *
+ * @return  CIPHER_INIT_SUCCESS if the key was expanded
+ * @return  CIPHER_ERR_INVALID_KEY_SIZE if the key size is not supported
+ */
+int aes_init_key_schedule(aes_key_t *key, const uint8_t *user_key,
+                          uint8_t key_size);
+
+/**
+ * @brief   Encrypts one block with an expanded key
+ *
+ * Same as @ref aes_encrypt, but without expanding the key first.
+ *
+ * @param       key           the key expanded by @ref aes_init_key_schedule
+ * @param       plain_block   a pointer to the plaintext-block (of size
+ *                            blocksize)
+ * @param       cipher_block  a pointer to the place where the ciphertext will
+ *                            be stored, may be @p plain_block
+ */
+void aes_encrypt_key_schedule(const aes_key_t *key, const uint8_t *plain_block,
+                              uint8_t *cipher_block);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
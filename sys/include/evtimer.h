@@ -31,6 +31,19 @@
  * - when a number of timeouts with the same callback function need to be
  *   scheduled, evtimer is using less RAM (due to storing the callback function
  *   only once), while each ztimer has a function pointer for the callback.
+ *
+ * By default, the pending events are kept in a list sorted by their expiry,
+ * so adding and removing an event takes linear time in the number of pending
+ * events. With the `evtimer_wheel` module, every event timer instead hashes
+ * its events into @ref CONFIG_EVTIMER_WHEEL_SLOTS slots by their expiry time
+ * in milliseconds (a "hashed timing wheel"). Adding an event then takes
+ * constant time and removing it only has to search its slot, at the cost of
+ * the slot table in every @ref evtimer_t and a search of the wheel whenever
+ * an event expires. Events expiring at the same time are handled in the
+ * order they were added in both modes.
+ *
+ * Code outside of evtimer should use @ref evtimer_is_set and
+ * @ref evtimer_find to inspect the pending events, which work for both modes.
  * @{
  *
  * @file
@@ -40,6 +53,7 @@
  * @author      Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -49,8 +63,27 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup sys_evtimer_conf  evtimer compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of slots of the timing wheel of an event timer
+ *
+ * Only used with the `evtimer_wheel` module. Must be a power of two. Each slot
+ * takes one pointer in @ref evtimer_t.
+ */
+#ifndef CONFIG_EVTIMER_WHEEL_SLOTS
+#define CONFIG_EVTIMER_WHEEL_SLOTS  (64U)
+#endif
+/** @} */
+
 /**
  * @brief   Generic event
+ *
+ * With the `evtimer_wheel` module, @ref evtimer_event_t::offset holds the
+ * absolute expiry time of the event while it is pending.
  */
 typedef struct evtimer_event {
     struct evtimer_event *next; /**< the next event in the queue */
@@ -62,6 +95,16 @@ typedef struct evtimer_event {
  */
 typedef void(*evtimer_callback_t)(evtimer_event_t* event);
 
+/**
+ * @brief   Filter function for @ref evtimer_find
+ *
+ * @param[in] event     A pending event
+ * @param[in] arg       Argument given to @ref evtimer_find
+ *
+ * @return  true, if @p event is the one looked for
+ */
+typedef bool (*evtimer_filter_t)(const evtimer_event_t *event, const void *arg);
+
 /**
  * @brief   Event timer
  */
@@ -70,7 +113,14 @@ typedef struct {
     uint32_t base;                  /**< Absolute time the first event is built on */
     evtimer_callback_t callback;    /**< Handler function for this evtimer's
                                          event type */
+#if !IS_USED(MODULE_EVTIMER_WHEEL) || defined(DOXYGEN)
     evtimer_event_t *events;        /**< Event queue */
+#endif
+#if IS_USED(MODULE_EVTIMER_WHEEL) || defined(DOXYGEN)
+    uint32_t next;                  /**< Time of the earliest event relative
+                                         to evtimer_t::base, 0 if idle */
+    evtimer_event_t *slots[CONFIG_EVTIMER_WHEEL_SLOTS]; /**< Timing wheel */
+#endif
 } evtimer_t;
 
 /**
@@ -101,6 +151,31 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event);
  */
 void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event);
 
+/**
+ * @brief   Checks if an event is pending on an event timer
+ *
+ * @param[in] evtimer       An event timer
+ * @param[in] event         An event
+ *
+ * @return  true, if @p event was added to @p evtimer and did not expire or
+ *          get removed since
+ */
+bool evtimer_is_set(const evtimer_t *evtimer, const evtimer_event_t *event);
+
+/**
+ * @brief   Finds the pending event of an event timer that expires first
+ *
+ * @param[in] evtimer       An event timer
+ * @param[in] filter        Function selecting the events to consider. May be
+ *                          NULL to consider all events.
+ * @param[in] arg           Argument for @p filter
+ * @param[out] remaining    Time until the event expires in ms. May be NULL.
+ *
+ * @return  The event found, NULL if there is none
+ */
+evtimer_event_t *evtimer_find(const evtimer_t *evtimer, evtimer_filter_t filter,
+                              const void *arg, uint32_t *remaining);
+
 /**
  * @brief   Print overview of current state of an event timer
  *
@@ -22,6 +22,7 @@
  */
 
 #include <stdio.h>
+#include "crypto/aes.h"
 #include "crypto/ciphers.h"
 
 #ifdef __cplusplus
@@ -33,10 +34,24 @@ extern "C" {
  */
 #define AES128_CMAC_BLOCK_SIZE 16
 
+/**
+ * @brief   AES128_CMAC key with the expanded AES key and the CMAC subkeys
+ *
+ * Computing a CMAC with a prepared key saves the AES key expansion for every
+ * block and the derivation of the subkeys.
+ */
+typedef struct {
+    aes_key_t aes;                      /**< expanded AES128 key */
+    uint8_t k1[AES128_CMAC_BLOCK_SIZE]; /**< subkey for complete last blocks */
+    uint8_t k2[AES128_CMAC_BLOCK_SIZE]; /**< subkey for padded last blocks */
+} aes128_cmac_key_t;
+
 /**
  * @brief   AES128_CMAC calculation context
  */
 typedef struct {
+    /** prepared key, NULL if @ref aes128_cmac_context_t::aes128_ctx is used */
+    const aes128_cmac_key_t *key;
     /** AES128 context */
     cipher_t aes128_ctx;
     /** auxiliary array for CMAC calculations **/
@@ -60,6 +75,29 @@ typedef struct {
 int aes128_cmac_init(aes128_cmac_context_t *ctx,
                      const uint8_t *key, uint8_t key_size);
 
+/**
+ * @brief Prepare an AES128 CMAC key for repeated use
+ *
+ * @param[out] key      Pointer to the key to prepare
+ * @param[in] raw_key   Key to be set
+ * @param[in] key_size  Size of the key
+ *
+ * @return CIPHER_INIT_SUCCESS if the key was prepared.
+ *         CIPHER_ERR_INVALID_KEY_SIZE if the key size is not valid.
+ */
+int aes128_cmac_key_init(aes128_cmac_key_t *key,
+                         const uint8_t *raw_key, uint8_t key_size);
+
+/**
+ * @brief Initialize AES128 CMAC message digest context with a prepared key
+ *
+ * @param[in] ctx     Pointer to the AES128 CMAC context to initialize
+ * @param[in] key     Prepared key, must stay valid until
+ *                    @ref aes128_cmac_final returned
+ */
+void aes128_cmac_init_key(aes128_cmac_context_t *ctx,
+                          const aes128_cmac_key_t *key);
+
 /**
  * @brief Update the AES128 CMAC context with a portion of the message being
  *        hashed
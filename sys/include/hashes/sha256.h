@@ -132,6 +132,21 @@ static inline void sha256_final(sha256_context_t *ctx, void *digest)
  */
 void sha256(const void *data, size_t len, void *digest);
 
+/**
+ * @brief Generate the hashes of @p n independent buffers
+ *
+ * Useful to e.g. verify several images or manifests at once, see
+ * @ref sha2xx_update_multi for how the buffers are processed.
+ *
+ * @param[in] data    array of @p n pointers to the buffers to hash
+ * @param[in] len     array of @p n lengths of the buffers
+ * @param[in] n       number of buffers
+ * @param[out] digest array of @p n pointers to arrays for the results,
+ *                    each of length SHA256_DIGEST_LENGTH
+ */
+void sha256_multi(const void *const data[], const size_t len[], unsigned n,
+                  void *const digest[]);
+
 /**
  * @brief hmac_sha256_init HMAC SHA-256 calculation. Initiate calculation of a HMAC
  * @param[in] ctx hmac_context_t handle to use
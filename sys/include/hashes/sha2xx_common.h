@@ -48,6 +48,7 @@
  * @author      Peter Kietzmann
  */
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdint.h>
 
@@ -55,6 +56,21 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of messages compressed in lockstep by
+ *          @ref sha2xx_update_multi
+ *
+ * Every lane adds 96 bytes of stack usage to the multi-buffer transform.
+ */
+#ifndef CONFIG_SHA2XX_MULTI_LANES
+#define CONFIG_SHA2XX_MULTI_LANES   (4)
+#endif
+
+/**
+ * @brief   Alias for @ref CONFIG_SHA2XX_MULTI_LANES
+ */
+#define SHA2XX_MULTI_LANES          CONFIG_SHA2XX_MULTI_LANES
+
 /**
  * @brief    Structure to hold the SHA-2XX context.
  */
@@ -83,6 +99,35 @@ void sha2xx_pad(sha2xx_context_t *ctx);
  */
 void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
 
+/**
+ * @brief Add bytes of @p n independent messages into their hashes
+ *
+ * Full blocks of up to @ref SHA2XX_MULTI_LANES messages are compressed in
+ * lockstep, which lets the compiler vectorize the rounds across messages.
+ * When a hardware transform is available (see @ref sha2xx_accel_available)
+ * the messages are hashed one after the other instead, as that is faster.
+ *
+ * @param ctx      array of @p n sha2xx_context_t handles to use
+ * @param[in] data array of @p n input buffers
+ * @param[in] len  array of @p n lengths of the buffers in @p data
+ * @param[in] n    number of messages
+ */
+void sha2xx_update_multi(sha2xx_context_t *const ctx[],
+                         const void *const data[], const size_t len[],
+                         unsigned n);
+
+/**
+ * @brief Check whether a hardware SHA-256 block transform is used
+ *
+ * The SHA-NI (x86) and ARMv8 cryptographic extension transforms are only
+ * compiled in with the `hashes_sha2xx_accel` module. On x86 the availability
+ * is additionally checked at runtime via CPUID.
+ *
+ * @retval  true    blocks are compressed using the CPU's SHA instructions
+ * @retval  false   the portable C implementation is used
+ */
+bool sha2xx_accel_available(void);
+
 /**
  * @brief SHA-2XX finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_malloc_ts
+ * @{
+ *
+ * @file
+ * @brief       Configuration and statistics of the per-thread caches of
+ *              `malloc_thread_safe_cache`
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the smallest size class in bytes
+ *
+ * Must be a power of two and a multiple of the alignment of `malloc()`.
+ */
+#ifndef CONFIG_MALLOC_THREAD_SAFE_CACHE_MIN_SIZE
+#define CONFIG_MALLOC_THREAD_SAFE_CACHE_MIN_SIZE    (16U)
+#endif
+
+/**
+ * @brief   Number of size classes, each one twice the size of the previous
+ *
+ * The default classes are 16, 32, 64 and 128 bytes. Larger allocations are
+ * always served by the C library.
+ */
+#ifndef CONFIG_MALLOC_THREAD_SAFE_CACHE_CLASSES
+#define CONFIG_MALLOC_THREAD_SAFE_CACHE_CLASSES     (4U)
+#endif
+
+/**
+ * @brief   Number of blocks reserved statically for each size class
+ */
+#ifndef CONFIG_MALLOC_THREAD_SAFE_CACHE_BLOCKS
+#define CONFIG_MALLOC_THREAD_SAFE_CACHE_BLOCKS      (16U)
+#endif
+
+/**
+ * @brief   Number of free blocks a thread keeps per size class
+ *
+ * Blocks are moved between a thread and the shared pool in batches of half
+ * this number, so that only every few allocations take the global lock.
+ */
+#ifndef CONFIG_MALLOC_THREAD_SAFE_CACHE_DEPTH
+#define CONFIG_MALLOC_THREAD_SAFE_CACHE_DEPTH       (4U)
+#endif
+
+/**
+ * @brief   Statistics of the per-thread caches
+ */
+typedef struct {
+    uint32_t locked;        /**< number of times the cached allocations had
+                                 to take the global lock */
+    uint32_t fallbacks;     /**< number of small allocations passed to the
+                                 C library, as the size class was exhausted */
+} malloc_thread_safe_cache_stats_t;
+
+/**
+ * @brief   Return all blocks cached by the calling thread to the shared pool
+ *
+ * Threads that are about to terminate should call this function, otherwise
+ * their cached blocks are only used again by a thread with the same PID.
+ */
+void malloc_thread_safe_cache_flush(void);
+
+/**
+ * @brief   Get the statistics of the per-thread caches
+ *
+ * @param[out]  stats   statistics since boot
+ */
+void malloc_thread_safe_cache_stats(malloc_thread_safe_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
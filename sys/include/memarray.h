@@ -16,6 +16,11 @@
  * @{
  *
  * @brief       pseudo dynamic allocation in static memory arrays
+ *
+ * The functions of @ref memarray_t are not thread-safe, users have to
+ * serialize the access to a pool. @ref memarray_atomic.h provides a variant
+ * that can be used from threads and interrupts concurrently.
+ *
  * @author      Tobias Heider <heidert@nm.ifi.lmu.de>
  * @author      Koen Zandberg <koen@bergzand.net>
  */
@@ -122,6 +127,35 @@ static inline void memarray_free(memarray_t *mem, void *ptr)
     mem->free_data = ptr;
 }
 
+/**
+ * @brief Allocate @p num memory chunks in memarray pool at once
+ *
+ * Either all or none of the chunks are allocated.
+ *
+ * @pre `mem != NULL`
+ * @pre `ptrs != NULL`
+ *
+ * @param[in,out] mem   memarray pool to allocate the blocks in
+ * @param[out]    ptrs  the allocated chunks
+ * @param[in]     num   number of chunks to allocate
+ *
+ * @return @p num, if enough memory was available
+ * @return 0, on failure
+ */
+size_t memarray_alloc_n(memarray_t *mem, void **ptrs, size_t num);
+
+/**
+ * @brief Free @p num memory chunks in memarray pool at once
+ *
+ * @pre `mem != NULL`
+ * @pre `ptrs != NULL` and all chunks in @p ptrs are not NULL
+ *
+ * @param[in,out] mem   memarray pool to free the blocks in
+ * @param[in]     ptrs  chunks to free
+ * @param[in]     num   number of chunks in @p ptrs
+ */
+void memarray_free_n(memarray_t *mem, void * const *ptrs, size_t num);
+
 /**
  * @brief Extend the memarray with a new memory region
  *
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_memarray
+ * @{
+ *
+ * @file
+ * @brief       Lock-free memory array allocator
+ *
+ * A variant of the @ref sys_memarray that can be used concurrently by any
+ * number of threads and interrupt service routines without disabling
+ * interrupts or locking a mutex.
+ *
+ * The free blocks are kept in a Treiber stack: the head of the free list and
+ * the link stored in every free block are indices of blocks, and the head is
+ * tagged with a counter incremented on every change, so that it can be
+ * updated with a single compare and swap of 32 bits. On platforms without
+ * atomic compare and swap instructions, the compare and swap disables
+ * interrupts for a few instructions instead.
+ *
+ * Unlike @ref memarray_t, a pool consists of a single memory region of at
+ * most @ref MEMARRAY_ATOMIC_MAX blocks and cannot be extended.
+ *
+ * The pool keeps track of the number of allocated blocks and of the maximum
+ * number allocated at the same time, to help sizing it.
+ */
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of blocks in a pool
+ */
+#define MEMARRAY_ATOMIC_MAX     (UINT16_MAX)
+
+/**
+ * @brief   Lock-free memory pool
+ *
+ * @note    All members are private, use the functions below
+ */
+typedef struct {
+    uint8_t *data;                  /**< memory of the pool */
+    size_t size;                    /**< size of a block */
+    uint16_t num;                   /**< number of blocks */
+    atomic_uint_least16_t used;     /**< number of allocated blocks */
+    atomic_uint_least16_t max_used; /**< high-water mark of `used` */
+    atomic_uint_least32_t head;     /**< tag in the upper half, index + 1
+                                         of the first free block or 0 in
+                                         the lower half */
+} memarray_atomic_t;
+
+/**
+ * @brief   Initialize a lock-free memory pool
+ *
+ * @pre     `size >= sizeof(uint16_t)` and a multiple of 2
+ * @pre     `num != 0` and `num <= MEMARRAY_ATOMIC_MAX`
+ *
+ * @param[out]  mem     memory pool to initialize
+ * @param[in]   data    memory of the pool, `num * size` bytes
+ * @param[in]   size    size of a single block
+ * @param[in]   num     number of blocks in @p data
+ */
+void memarray_atomic_init(memarray_atomic_t *mem, void *data, size_t size,
+                          size_t num);
+
+/**
+ * @brief   Allocate @p num blocks at once
+ *
+ * Either all or none of the blocks are allocated. Safe to call from interrupt
+ * context.
+ *
+ * @param[in,out]   mem     memory pool to allocate from
+ * @param[out]      ptrs    the allocated blocks
+ * @param[in]       num     number of blocks to allocate
+ *
+ * @return  @p num on success
+ * @return  0, if less than @p num blocks were available
+ */
+size_t memarray_atomic_alloc_n(memarray_atomic_t *mem, void **ptrs,
+                               size_t num);
+
+/**
+ * @brief   Return @p num blocks at once
+ *
+ * Safe to call from interrupt context.
+ *
+ * @pre     All blocks in @p ptrs were allocated from @p mem
+ *
+ * @param[in,out]   mem     memory pool to return the blocks to
+ * @param[in]       ptrs    blocks to return
+ * @param[in]       num     number of blocks in @p ptrs
+ */
+void memarray_atomic_free_n(memarray_atomic_t *mem, void * const *ptrs,
+                            size_t num);
+
+/**
+ * @brief   Allocate a block
+ *
+ * Safe to call from interrupt context.
+ *
+ * @param[in,out]   mem     memory pool to allocate from
+ *
+ * @return  the allocated block, not cleared
+ * @return  NULL, if the pool is exhausted
+ */
+static inline void *memarray_atomic_alloc(memarray_atomic_t *mem)
+{
+    void *ptr;
+
+    return memarray_atomic_alloc_n(mem, &ptr, 1) ? ptr : NULL;
+}
+
+/**
+ * @brief   Return a block
+ *
+ * Safe to call from interrupt context.
+ *
+ * @param[in,out]   mem     memory pool to return the block to
+ * @param[in]       ptr     block to return
+ */
+static inline void memarray_atomic_free(memarray_atomic_t *mem, void *ptr)
+{
+    memarray_atomic_free_n(mem, &ptr, 1);
+}
+
+/**
+ * @brief   Get the number of free blocks
+ *
+ * @param[in]   mem     memory pool
+ *
+ * @return  number of free blocks, may change at any time
+ */
+static inline size_t memarray_atomic_available(const memarray_atomic_t *mem)
+{
+    return mem->num - atomic_load_explicit(&mem->used, memory_order_relaxed);
+}
+
+/**
+ * @brief   Get the maximum number of blocks allocated at the same time
+ *
+ * @param[in]   mem     memory pool
+ *
+ * @return  high-water mark since initialization or the last call of
+ *          @ref memarray_atomic_reset_high_water
+ */
+static inline size_t memarray_atomic_high_water(const memarray_atomic_t *mem)
+{
+    return atomic_load_explicit(&mem->max_used, memory_order_relaxed);
+}
+
+/**
+ * @brief   Reset the high-water mark to the number of allocated blocks
+ *
+ * @param[in,out]   mem     memory pool
+ */
+static inline void memarray_atomic_reset_high_water(memarray_atomic_t *mem)
+{
+    atomic_store_explicit(&mem->max_used,
+                          atomic_load_explicit(&mem->used,
+                                               memory_order_relaxed),
+                          memory_order_relaxed);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -173,6 +173,42 @@ int credman_add(const credman_credential_t *credential);
 int credman_get(credman_credential_t *credential, credman_tag_t tag,
                 credman_type_t type);
 
+/**
+ * @brief Gets a PSK credential by its identity
+ *
+ * The credentials are indexed by a hash of their identity, so the lookup
+ * does not depend on the number of credentials in the pool.
+ *
+ * @param[out] credential   Found credential
+ * @param[in] tags          Tags of the credentials to consider, e.g. the ones
+ *                          assigned to a DTLS sock
+ * @param[in] tags_len      Number of tags in @p tags
+ * @param[in] id            PSK identity to look for
+ * @param[in] id_len        Length of @p id
+ * @return CREDMAN_OK on success, if several credentials match, the one whose
+ *         tag comes first in @p tags
+ * @return CREDMAN_NOT_FOUND if no credential with one of @p tags has the
+ *         identity @p id
+ */
+int credman_get_psk_by_id(credman_credential_t *credential, const credman_tag_t *tags,
+                          size_t tags_len, const void *id, size_t id_len);
+
+/**
+ * @brief Gets a PSK credential by its identity hint
+ *
+ * @param[out] credential   Found credential
+ * @param[in] tags          Tags of the credentials to consider
+ * @param[in] tags_len      Number of tags in @p tags
+ * @param[in] hint          PSK identity hint to look for
+ * @param[in] hint_len      Length of @p hint
+ * @return CREDMAN_OK on success, if several credentials match, the one whose
+ *         tag comes first in @p tags
+ * @return CREDMAN_NOT_FOUND if no credential with one of @p tags has the
+ *         identity hint @p hint
+ */
+int credman_get_psk_by_hint(credman_credential_t *credential, const credman_tag_t *tags,
+                            size_t tags_len, const void *hint, size_t hint_len);
+
 /**
  * @brief Delete a credential from the credential pool. Does nothing if
  *        credential with credman_credential_t::tag @p tag and
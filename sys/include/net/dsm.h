@@ -55,6 +55,21 @@ typedef enum {
     SESSION_STATE_ESTABLISHED
 } dsm_state_t;
 
+/**
+ * @brief   Session statistics
+ *
+ * Every handshake costs a multiple of the CPU time and radio traffic of
+ * sending on a stored session, comparing @ref dsm_stats_t::handshakes to
+ * @ref dsm_stats_t::restored shows how well the sessions are kept alive.
+ */
+typedef struct {
+    uint32_t handshakes;    /**< sessions established with a handshake */
+    uint32_t restored;      /**< requests that were sent on an established
+                                 session instead of starting a handshake,
+                                 see @ref dsm_count_restored */
+    uint32_t evicted;       /**< sessions evicted to free up a slot */
+} dsm_stats_t;
+
 /**
  * @brief   Initialize the DTLS session management
  *
@@ -116,6 +131,52 @@ uint8_t dsm_get_num_available_slots(void);
  */
 ssize_t dsm_get_least_recently_used_session(sock_dtls_t *sock, sock_dtls_session_t *session);
 
+/**
+ * @brief   Marks a stored session as used
+ *
+ * Should be called whenever data is received on a session, sending data
+ * already marks it by @ref dsm_store.
+ *
+ * @param[in]   sock        @ref sock_dtls_t, which the session is created on
+ * @param[in]   session     Session that was used
+ */
+void dsm_refresh(sock_dtls_t *sock, sock_dtls_session_t *session);
+
+/**
+ * @brief   Evicts the least recently used session that is idle
+ *
+ * Only established sessions that have not been used for at least
+ * @p min_idle_sec seconds are considered, so that sessions in active use do
+ * not have to be established again. The session is removed from the session
+ * management, the caller has to destroy it on @p sock.
+ *
+ * @param[in]   sock            @ref sock_dtls_t, which the session is created on
+ * @param[out]  session         Evicted session
+ * @param[in]   min_idle_sec    Minimum time in seconds the session was not used
+ *
+ * @return   1, on success
+ * @return   -1, when no session is idle for long enough
+ */
+ssize_t dsm_evict_idle_session(sock_dtls_t *sock, sock_dtls_session_t *session,
+                               uint32_t min_idle_sec);
+
+/**
+ * @brief   Counts a request that skipped a handshake
+ *
+ * Only the user of the session management knows where a request starts, a
+ * session is looked up with @ref dsm_store for every record sent. So the user
+ * calls this once per request for which @ref dsm_store found an established
+ * session.
+ */
+void dsm_count_restored(void);
+
+/**
+ * @brief   Gets the session statistics
+ *
+ * @param[out]  stats       Statistics since initialization
+ */
+void dsm_get_stats(dsm_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
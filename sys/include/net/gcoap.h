@@ -357,6 +357,10 @@
  * session slots available to keep the server responsive. If not enough sessions
  * are available the server destroys the session that has not been used for the
  * longest time after CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_USEC.
+ * Only sessions idle for CONFIG_GCOAP_DTLS_SESSION_IDLE_SEC are destroyed, unless
+ * no session slot is left, as the peer of a destroyed session has to do a full
+ * handshake again. dsm_get_stats() counts the handshakes, the requests sent on
+ * an established session instead, and the evictions.
  *
  * ## Implementation Notes ##
  *
@@ -456,6 +460,16 @@ extern "C" {
 #define CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_MSEC  (15 * MS_PER_SEC)
 #endif
 
+/**
+ * @brief   Time in seconds a session must not have been used before it is
+ *          closed to free up a session slot
+ *
+ * Sessions in use are only closed if no session slot is left at all.
+ */
+#ifndef CONFIG_GCOAP_DTLS_SESSION_IDLE_SEC
+#define CONFIG_GCOAP_DTLS_SESSION_IDLE_SEC  (60)
+#endif
+
 /**
  * @brief   Size of the buffer used to build a CoAP request or response
  */
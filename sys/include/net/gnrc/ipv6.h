@@ -149,6 +149,18 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Number of destinations the next hop is cached for with module
+ *          `gnrc_ipv6_route_cache`
+ *
+ * Forwarded packets to a destination in the cache skip the lookup in the
+ * @ref net_gnrc_ipv6_nib "NIB". The cache is direct-mapped, so each entry
+ * takes the size of an IPv6 address, a pointer and the link-layer address.
+ */
+#ifndef CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE      (8U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
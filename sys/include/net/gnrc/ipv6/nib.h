@@ -358,6 +358,24 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the generation of the NIB
+ *
+ * The generation changes whenever the NIB may have changed, e.g. by adding
+ * or removing routes, neighbors or prefixes or by a change of the
+ * reachability of a neighbor. As long as it does not change,
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() yields the same next hop for the
+ * same destination, so users may cache its results together with the
+ * generation at the time of the lookup.
+ *
+ * @note    A lookup with @ref gnrc_ipv6_nib_get_next_hop_l2addr() itself
+ *          changes the generation, unless the next hop is a reachable
+ *          neighbor.
+ *
+ * @return  The current generation of the NIB.
+ */
+uint32_t gnrc_ipv6_nib_generation(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
@@ -41,6 +41,20 @@ extern "C" {
 #ifndef CONFIG_GNRC_LORAWAN_MIN_SYMBOLS_TIMEOUT
 #define CONFIG_GNRC_LORAWAN_MIN_SYMBOLS_TIMEOUT 30
 #endif
+
+/**
+ * @brief the number of session keys with a cached AES key schedule and
+ *        CMAC subkeys
+ *
+ * LoRaWAN 1.0 uses two distinct session keys, LoRaWAN 1.1 up to four.
+ */
+#ifndef CONFIG_GNRC_LORAWAN_CRYPTO_CACHE_SIZE
+#if IS_USED(MODULE_GNRC_LORAWAN_1_1)
+#define CONFIG_GNRC_LORAWAN_CRYPTO_CACHE_SIZE 4
+#else
+#define CONFIG_GNRC_LORAWAN_CRYPTO_CACHE_SIZE 2
+#endif
+#endif
 /** @} */
 
 #define GNRC_LORAWAN_REQ_STATUS_SUCCESS (0)     /**< MLME or MCPS request successful status */
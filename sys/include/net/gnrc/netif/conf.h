@@ -129,6 +129,23 @@ extern "C" {
                                         GNRC_NETIF_IPV6_RTR_ADDR + 1)
 #endif
 
+/**
+ * @brief   Number of entries of the IPv6 address hash table
+ *
+ * With the `gnrc_netif_ipv6_hash` module, the unicast and multicast addresses
+ * of all interfaces are indexed in a hash table with this many entries of
+ * 8 bytes each (16 bytes on 64-bit platforms). It should be at least twice
+ * the number of addresses and groups configured on all interfaces combined.
+ * If it is exhausted, addresses are looked up by searching all interfaces.
+ *
+ * Default: large enough for two interfaces with all addresses and groups in
+ * use.
+ */
+#ifndef CONFIG_GNRC_NETIF_IPV6_HASH_SIZE
+#define CONFIG_GNRC_NETIF_IPV6_HASH_SIZE   (4 * (CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF + \
+                                                 GNRC_NETIF_IPV6_GROUPS_NUMOF))
+#endif
+
 /**
  * @brief   Maximum length of the link-layer address.
  *
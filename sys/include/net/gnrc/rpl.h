@@ -451,6 +451,14 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
 #define GNRC_RPL_OPT_TARGET_DESC          (9)
 /** @} */
 
+/**
+ * @brief Link ETX routing metric type
+ *  @see <a href="https://tools.ietf.org/html/rfc6551#section-4.3.2">
+ *          RFC 6551, section 4.3.2
+ *      </a>
+ */
+#define GNRC_RPL_METRIC_ETX (7)
+
 /**
  * @brief Rank of the root node
  */
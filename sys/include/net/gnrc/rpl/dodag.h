@@ -142,8 +142,12 @@ bool gnrc_rpl_parent_remove(gnrc_rpl_parent_t *parent);
 /**
  * @brief   Update a @p parent of the @p dodag.
  *
+ * The parents of a DODAG are kept ordered by the objective function, the
+ * preferred parent being the first. This must be called whenever the rank or
+ * link metric of @p parent changed, so it is moved to its new position.
+ *
  * @param[in] dodag     Pointer to the DODAG
- * @param[in] parent    Pointer to the parent
+ * @param[in] parent    Pointer to the parent, NULL after a parent was removed
  */
 void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent);
 
@@ -242,7 +242,9 @@ struct gnrc_rpl_parent {
     uint8_t dtsn;                   /**< last seen dtsn of this parent */
     uint16_t rank;                  /**< rank of the parent */
     gnrc_rpl_dodag_t *dodag;        /**< DODAG the parent belongs to */
-    double link_metric;             /**< metric of the link */
+    double link_metric;             /**< metric of the link, with
+                                         `netstats_neighbor_etx` the ETX
+                                         sampled when the parent is updated */
     uint8_t link_metric_type;       /**< type of the metric */
     /**
      * @brief Parent timeout events (see @ref GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT)
@@ -310,7 +312,7 @@ typedef struct {
  */
 struct gnrc_rpl_dodag {
     ipv6_addr_t dodag_id;           /**< id of the DODAG */
-    gnrc_rpl_parent_t *parents;     /**< pointer to the parents list of this DODAG */
+    gnrc_rpl_parent_t *parents;     /**< parents of this DODAG, ordered by the OF */
     gnrc_rpl_instance_t *instance;  /**< pointer to the instance that this dodag is part of */
     uint8_t dtsn;                   /**< DAO Trigger Sequence Number */
     uint8_t prf;                    /**< preferred flag */
@@ -73,6 +73,23 @@ extern "C" {
 #define GNRC_UDP_MSG_QUEUE_SIZE    (1 << CONFIG_GNRC_UDP_MSG_QUEUE_SIZE_EXP)
 #endif
 
+/**
+ * @brief   Message type to hand several packets to the UDP thread at once
+ *
+ * The content of the message points to a @ref gnrc_udp_batch_t. The UDP
+ * thread replies with a @ref GNRC_NETAPI_MSG_TYPE_ACK message once it sent
+ * all packets of the batch.
+ */
+#define GNRC_UDP_MSG_TYPE_SND_MANY  (0x0207)
+
+/**
+ * @brief   Packets for @ref GNRC_UDP_MSG_TYPE_SND_MANY
+ */
+typedef struct {
+    gnrc_pktsnip_t **pkts;  /**< the packets, as for @ref GNRC_NETAPI_MSG_TYPE_SND */
+    unsigned num;           /**< number of packets in gnrc_udp_batch_t::pkts */
+} gnrc_udp_batch_t;
+
 /**
  * @brief   Calculate the checksum for the given packet
  *
@@ -102,6 +119,22 @@ int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr);
 gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
                                    uint16_t dst);
 
+/**
+ * @brief   Send several UDP packets
+ *
+ * If the UDP thread is the only one registered for @ref GNRC_NETTYPE_UDP,
+ * all packets are handed to it in one @ref GNRC_UDP_MSG_TYPE_SND_MANY
+ * message, so the calling thread is preempted by the UDP thread only once.
+ * Otherwise, every packet is dispatched on its own with
+ * @ref gnrc_netapi_dispatch_send().
+ *
+ * @param[in] pkts  Packets to send, each starting with its network layer
+ *                  header (or a netif header) followed by its UDP header.
+ *                  The packets are released by the stack.
+ * @param[in] num   Number of packets in @p pkts
+ */
+void gnrc_udp_send_many(gnrc_pktsnip_t **pkts, unsigned num);
+
 /**
  * @brief   Initialize and start UDP
  *
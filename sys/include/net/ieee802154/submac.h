@@ -94,6 +94,15 @@
  *
  * Unexpected events will be reported and asserted.
  *
+ * With the `ieee802154_submac_pipeline` module, the upper layer can pass the
+ * next frame to @ref ieee802154_send while the current one is still in
+ * CSMA-CA, in flight or waiting for its ACK. The SubMAC copies it into a
+ * buffer of its own and writes it to the radio right when the current
+ * transmission ends, before reporting
+ * @ref ieee802154_submac_cb_t::tx_done. Building and securing the next frame
+ * thus overlaps with the current transmission, and the frame after it can
+ * already be queued from within the callback.
+ *
  * The upper layer needs to implement the following callbacks:
  *
  * - @ref ieee802154_submac_cb_t::rx_done.
@@ -114,6 +123,7 @@ extern "C" {
 #include <stdio.h>
 #include <string.h>
 #include "assert.h"
+#include "kernel_defines.h"
 
 #include "net/ieee802154.h"
 #include "net/ieee802154/radio.h"
@@ -147,7 +157,9 @@ typedef struct {
      * This function is called from the SubMAC to indicate that the TX
      * procedure finished.
      *
-     * The SubMAC will automatically go to IDLE.
+     * The SubMAC will automatically go to IDLE, unless a frame was queued
+     * with the `ieee802154_submac_pipeline` module. The transmission of that
+     * frame has already started when this function is called.
      *
      * @param[in] submac pointer to the SubMAC descriptor
      * @param[out] info TX information associated to the transmission (status,
@@ -208,6 +220,13 @@ struct ieee802154_submac {
     ieee802154_fsm_state_t fsm_state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
     const iolist_t *psdu;               /**< stores the current PSDU */
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE) || defined(DOXYGEN)
+    iolist_t next_iol;                  /**< points to the queued PSDU */
+    uint8_t next_len;                   /**< length of the queued PSDU,
+                                             0 if none is queued */
+    uint8_t next_psdu[IEEE802154_FRAME_LEN_MAX]; /**< PSDU queued behind the
+                                                      current transmission */
+#endif
 };
 
 /**
@@ -220,10 +239,17 @@ struct ieee802154_submac {
  * @param[in] submac pointer to the SubMAC descriptor
  * @param[in] iolist pointer to the PSDU frame (without FCS)
  *
+ * With the `ieee802154_submac_pipeline` module, a frame passed while a
+ * transmission is ongoing is copied and queued behind it. The frame does not
+ * need to be kept by the caller then.
+ *
  * @return 0 on success
  * @return -EBUSY if the SubMAC is not in RX or IDLE state or if called inside
  *         @ref ieee802154_submac_cb_t::rx_done or
- *         @ref ieee802154_submac_cb_t::tx_done
+ *         @ref ieee802154_submac_cb_t::tx_done, with the
+ *         `ieee802154_submac_pipeline` module only if a frame is already
+ *         queued
+ * @return -EOVERFLOW if the frame to queue is too long
  */
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist);
 
@@ -43,6 +43,33 @@ extern "C" {
 #define NETSTATS_NB_QUEUE_SIZE  (4)
 #endif
 
+/**
+ * @brief   The number of buckets of the hash index over the peer stats table
+ *
+ * Neighbors are looked up by their L2 address on every sent and received
+ * frame, the index keeps that lookup independent of the table size.
+ */
+#ifndef NETSTATS_NB_HASH_SIZE
+#define NETSTATS_NB_HASH_SIZE   (NETSTATS_NB_SIZE)
+#endif
+
+/**
+ * @brief   The number of buckets of the per peer TX time histogram
+ *
+ * Bucket `i` counts frames that took less than
+ * `NETSTATS_NB_TX_HIST_MIN_US << i` to send, the last bucket all others.
+ */
+#ifndef NETSTATS_NB_TX_HIST_BUCKETS
+#define NETSTATS_NB_TX_HIST_BUCKETS (8)
+#endif
+
+/**
+ * @brief   Upper bound of the first bucket of the TX time histogram in µs
+ */
+#ifndef NETSTATS_NB_TX_HIST_MIN_US
+#define NETSTATS_NB_TX_HIST_MIN_US  (512)
+#endif
+
 /**
  * @name @ref net_netstats module names
  * @{
@@ -95,6 +122,12 @@ typedef struct {
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_LQI) || DOXYGEN
     uint8_t  lqi;           /**< Average LQI of received frames */
 #endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_HIST) || DOXYGEN
+    /**
+     * @brief Histogram of frame TX times, see @ref NETSTATS_NB_TX_HIST_BUCKETS
+     */
+    uint16_t tx_hist[NETSTATS_NB_TX_HIST_BUCKETS];
+#endif
 } netstats_nb_t;
 
 /**
@@ -121,6 +154,16 @@ typedef struct {
      */
     netstats_nb_t pstats[NETSTATS_NB_SIZE];
 
+    /**
+     * @brief Index + 1 of the first entry of each hash bucket, 0 if empty
+     */
+    uint8_t hash_head[NETSTATS_NB_HASH_SIZE];
+
+    /**
+     * @brief Index + 1 of the next entry in the same hash bucket, 0 if last
+     */
+    uint8_t hash_next[NETSTATS_NB_SIZE];
+
     /**
      * @brief Neighbor Table access lock
      */
@@ -119,6 +119,9 @@ void netstats_nb_init(netif_t *netif);
 /**
  * @brief Find a neighbor stat by the mac address.
  *
+ * The lookup uses a hash index, so it is cheap enough to be done on every
+ * routing decision.
+ *
  * @param[in] netif     network interface descriptor
  * @param[in] l2_addr   pointer to the L2 address
  * @param[in] len       length of the L2 address
@@ -373,6 +373,27 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram for @ref sock_udp_send_many() and
+ *          @ref sock_udp_recv_many()
+ */
+typedef struct {
+    /**
+     * @brief   Payload chunks to send or buffers to receive into
+     *
+     * Processed in order. May be `NULL` for an empty datagram to send.
+     */
+    iolist_t *snips;
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * Sending: may be `NULL`, if the sock has a remote end point.
+     * Receiving: may be `NULL`, if it is not required by the application.
+     */
+    sock_udp_ep_t *remote;
+    size_t len;             /**< Number of bytes sent or received */
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -797,6 +818,67 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Sends multiple UDP messages
+ *
+ * Stacks that can take several datagrams at once get all of them in one go,
+ * e.g. GNRC hands them to its UDP thread in one message and lwIP locks its
+ * core only once for all of them. Otherwise, this is equivalent to calling
+ * @ref sock_udp_sendv() for every datagram.
+ *
+ * @pre `(sock != NULL) && ((msgs != NULL) || (num == 0))`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  The datagrams to send. sock_udp_msg_t::len is set to
+ *                      the number of bytes sent for each datagram sent.
+ * @param[in] num       Number of datagrams in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of datagrams sent on success. If it is less than
+ *          @p num, sending the next datagram failed.
+ * @return  A negative errno as returned by @ref sock_udp_sendv_aux(), if
+ *          sending the first datagram failed.
+ */
+int sock_udp_send_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num);
+
+/**
+ * @brief   Receives multiple UDP messages
+ *
+ * Waits up to @p timeout for the first datagram, and then takes all further
+ * datagrams that are already waiting, up to @p num.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Buffers for the received datagrams.
+ *                      sock_udp_msg_t::len is set to the number of bytes
+ *                      received for each datagram received.
+ * @param[in] num       Number of datagrams in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    A datagram after the first that does not fit into its buffers
+ *          ends the batch and is left for the next call. If the first
+ *          datagram does not fit, it is dropped and `-ENOBUFS` is returned,
+ *          as with @ref sock_udp_recv().
+ *
+ * @return  The number of datagrams received on success.
+ * @return  A negative errno as returned by @ref sock_udp_recv_aux(), if
+ *          receiving the first datagram failed.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout);
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
@@ -58,6 +58,8 @@
  * @}
  */
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
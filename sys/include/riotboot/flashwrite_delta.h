@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_riotboot_flashwrite_delta riotboot delta update stage
+ * @ingroup     sys_riotboot_flashwrite
+ * @{
+ *
+ * @file
+ * @brief       Reconstruct a firmware image from a delta while writing it
+ *
+ * This module sits between the transport and @ref riotboot_flashwrite_putbytes.
+ * Instead of the full image, the transport feeds a VCDIFF (RFC 3284) delta
+ * that describes the new image in terms of an image that is already present
+ * on the device, usually the running slot. The delta is applied on the fly
+ * using @ref pkg_tinyvcdiff and the reconstructed image is passed to the
+ * riotboot flash writer, so no additional RAM or flash is needed to hold
+ * either the delta or the new image.
+ *
+ * The delta must describe the complete slot image, including the riotboot
+ * header. Bytes the writer was told to skip (usually
+ * @ref RIOTBOOT_FLASHWRITE_SKIPLEN) are dropped from the output. The result
+ * is verified as usual using @ref riotboot_flashwrite_verify_sha256.
+ *
+ * With the `riotboot_flashwrite_delta_heatshrink` module, the delta is
+ * expected to be compressed using @ref pkg_heatshrink with the window and
+ * lookahead sizes given by `HEATSHRINK_STATIC_WINDOW_BITS` and
+ * `HEATSHRINK_STATIC_LOOKAHEAD_BITS`.
+ *
+ * Deltas in the format understood by this module can be created with
+ * open-vcdiff:
+ *
+ *     vcdiff delta -interleaved -dictionary slot0.bin <new.bin >delta.bin
+ *     heatshrink -e -w 8 -l 4 delta.bin delta.hs
+ *
+ * Usage:
+ *
+ * ```c
+ * riotboot_flashwrite_init(&writer, riotboot_slot_other());
+ * riotboot_flashwrite_delta_init(&delta, &writer, riotboot_slot_current());
+ *
+ * while (more data) {
+ *     riotboot_flashwrite_delta_putbytes(&delta, chunk, chunk_len);
+ * }
+ *
+ * riotboot_flashwrite_delta_finish(&delta);
+ * riotboot_flashwrite_finish(&writer);
+ * if (riotboot_flashwrite_verify_sha256(digest, writer.offset,
+ *                                       riotboot_slot_other()) != 0) {
+ *     riotboot_flashwrite_invalidate(riotboot_slot_other());
+ * }
+ * ```
+ *
+ * @note    With `CONFIG_RIOTBOOT_FLASHWRITE_RAW`, the first block of the image
+ *          is only written by @ref riotboot_flashwrite_finish, so the digest
+ *          of the slot can only be checked afterwards.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "modules.h"
+#include "riotboot/flashwrite.h"
+#include "vcdiff.h"
+#if IS_USED(MODULE_TINYVCDIFF_MTD) || DOXYGEN
+#include "vcdiff_mtd.h"
+#endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA_HEATSHRINK) || DOXYGEN
+#include "heatshrink_decoder.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the buffer between the heatshrink decoder and the delta
+ *          decoder
+ */
+#ifndef CONFIG_RIOTBOOT_FLASHWRITE_DELTA_BUFSIZE
+#define CONFIG_RIOTBOOT_FLASHWRITE_DELTA_BUFSIZE    (64U)
+#endif
+
+/**
+ * @brief   Delta update state
+ *
+ * @note    This struct embeds the delta decoder state, don't place it on a
+ *          small stack.
+ */
+typedef struct {
+    riotboot_flashwrite_t *writer;  /**< writer the new image is passed to */
+    vcdiff_t vcdiff;                /**< delta decoder state */
+    int source_slot;                /**< slot the source image is read from */
+    size_t skip;                    /**< leading output bytes not written */
+    /**
+     * @brief   Skipped leading bytes, kept for copies from the target
+     */
+    uint8_t head[RIOTBOOT_FLASHWRITE_SKIPLEN];
+#if IS_USED(MODULE_TINYVCDIFF_MTD) || DOXYGEN
+    vcdiff_mtd_t source_mtd;        /**< source image on an MTD device */
+#endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA_HEATSHRINK) || DOXYGEN
+    heatshrink_decoder hsd;         /**< delta decompressor state */
+    /**
+     * @brief   Decompressed delta bytes
+     */
+    uint8_t buf[CONFIG_RIOTBOOT_FLASHWRITE_DELTA_BUFSIZE];
+#endif
+} riotboot_flashwrite_delta_t;
+
+/**
+ * @brief   Initialize a delta update using a slot as source image
+ *
+ * @p writer must have been initialized using @ref riotboot_flashwrite_init
+ * or @ref riotboot_flashwrite_init_raw with an offset not larger than
+ * @ref RIOTBOOT_FLASHWRITE_SKIPLEN, and must not have been written to yet.
+ *
+ * @param[out]      delta       delta update state
+ * @param[in,out]   writer      initialized writer for the target slot
+ * @param[in]       source_slot slot holding the image the delta is based on,
+ *                              must not be the target slot
+ *
+ * @returns         0 on success, <0 otherwise
+ */
+int riotboot_flashwrite_delta_init(riotboot_flashwrite_delta_t *delta,
+                                   riotboot_flashwrite_t *writer,
+                                   int source_slot);
+
+#if IS_USED(MODULE_TINYVCDIFF_MTD) || DOXYGEN
+/**
+ * @brief   Initialize a delta update using an MTD device as source image
+ *
+ * Same as @ref riotboot_flashwrite_delta_init, but the image the delta is
+ * based on is read from offset 0 of @p source, e.g. a backup copy of the
+ * running image on external flash.
+ *
+ * @param[out]      delta       delta update state
+ * @param[in,out]   writer      initialized writer for the target slot
+ * @param[in]       source      MTD device holding the source image
+ *
+ * @returns         0 on success, <0 otherwise
+ */
+int riotboot_flashwrite_delta_init_mtd(riotboot_flashwrite_delta_t *delta,
+                                       riotboot_flashwrite_t *writer,
+                                       mtd_dev_t *source);
+#endif
+
+/**
+ * @brief   Feed delta bytes into the update
+ *
+ * The reconstructed image is written using @ref riotboot_flashwrite_putbytes.
+ *
+ * @param[in,out]   delta   delta update state
+ * @param[in]       bytes   ptr to delta data
+ * @param[in]       len     len of delta data
+ *
+ * @returns         0 on success, <0 otherwise
+ */
+int riotboot_flashwrite_delta_putbytes(riotboot_flashwrite_delta_t *delta,
+                                       const uint8_t *bytes, size_t len);
+
+/**
+ * @brief   Finish applying the delta
+ *
+ * Checks that the delta was complete and flushes the writer. The size of the
+ * reconstructed image is `writer->offset` afterwards. The update still needs
+ * to be finished using @ref riotboot_flashwrite_finish and verified.
+ *
+ * @param[in,out]   delta   delta update state
+ *
+ * @returns         0 on success, <0 otherwise
+ */
+int riotboot_flashwrite_delta_finish(riotboot_flashwrite_delta_t *delta);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
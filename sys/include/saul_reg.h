@@ -15,6 +15,12 @@
  *
  * @see @ref drivers_saul
  *
+ * With the `saul_reg_index` module, the registry keeps hash tables of the
+ * first device of every type and of every name, so that
+ * @ref saul_reg_find_type, @ref saul_reg_find_name and
+ * @ref saul_reg_find_type_and_name don't have to walk the whole registry.
+ * This costs two tables of @ref CONFIG_SAUL_REG_INDEX_SIZE pointers.
+ *
  * @{
  *
  * @file
@@ -23,6 +29,7 @@
  * @author      Hauke Petersen <hauke.petersen@fu-berlin.de>
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "saul.h"
@@ -32,6 +39,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of distinct types and of distinct names that are indexed
+ *
+ * Only used with the `saul_reg_index` module. Lookups of types or names that
+ * did not fit into the index walk the registry.
+ */
+#ifndef CONFIG_SAUL_REG_INDEX_SIZE
+#define CONFIG_SAUL_REG_INDEX_SIZE  (32U)
+#endif
+
 /**
  * @brief   SAUL registry entry
  */
@@ -122,6 +139,22 @@ saul_reg_t *saul_reg_find_type_and_name(uint8_t type, const char *name);
  */
 int saul_reg_read(saul_reg_t *dev, phydat_t *res);
 
+/**
+ * @brief   Read data from several devices at once
+ *
+ * The devices are read one after the other, in the order given.
+ *
+ * @param[in] devs      devices to read from, may contain NULL entries
+ * @param[in] num       number of devices in @p devs
+ * @param[out] res      @p num locations to store the results in
+ * @param[out] dims     @p num locations to store the return value of
+ *                      @ref saul_reg_read for each device in, may be NULL
+ *
+ * @return      the number of devices that were read successfully
+ */
+size_t saul_reg_read_many(saul_reg_t *const *devs, size_t num, phydat_t *res,
+                          int *dims);
+
 /**
  * @brief   Write data to the given device
  *
@@ -18,6 +18,30 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * Profiling
+ * ---------
+ *
+ * The `schedstatistics_profile` pseudomodule additionally records per thread
+ *
+ * - a histogram of the latency between a thread becoming runnable and it being
+ *   scheduled (@ref schedstat_t::latency),
+ * - how often it was switched away from while waiting (voluntary) and while
+ *   still runnable (preempted), and
+ * - its highest stack usage, sampled periodically (needs `DEVELHELP`).
+ *
+ * There is no hook for the time interrupts are disabled, as
+ * `irq_disable()` is implemented inline by each CPU. Instead, a periodic timer
+ * measures how late its callback is executed (@ref sched_irq_latency), which
+ * includes the time the interrupt was held back by disabled interrupts or
+ * other ISRs.
+ *
+ * The statistics are printed by `ps` and, machine readable, by the
+ * `schedstat` shell command.
+ *
+ * @note        The periodic timer keeps `ZTIMER_USEC` running, set
+ *              @ref CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US to 0 to disable it
+ *              on low-power nodes.
  * @{
  *
  * @file
@@ -30,10 +54,38 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of the latency histograms
+ *
+ * Bucket 0 counts latencies below 2 us, bucket i latencies from 2^i us to
+ * below 2^(i + 1) us and the last bucket all latencies above.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS
+#define CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS  (16U)
+#endif
+
+/**
+ * @brief   Period of the timer measuring the interrupt latency and sampling
+ *          the stack usage in microseconds, 0 to disable it
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US
+#define CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US (10000U)
+#endif
+
+/**
+ *  Latency histogram
+ */
+typedef struct {
+    uint32_t count[CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS]; /**< buckets */
+    uint32_t max_us;         /**< highest latency in microseconds */
+} schedstat_hist_t;
+
 /**
  *  Scheduler statistics
  */
@@ -42,6 +94,16 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE) || defined(DOXYGEN)
+    uint32_t runnable_since; /**< Time stamp of the thread becoming runnable */
+    unsigned int voluntary;  /**< How often the thread was switched away from
+                                  while waiting */
+    unsigned int preempted;  /**< How often the thread was switched away from
+                                  while still runnable */
+    schedstat_hist_t latency; /**< Latency between the thread becoming
+                                   runnable and being scheduled */
+    unsigned int stack_used; /**< Highest stack usage sampled in bytes */
+#endif
 } schedstat_t;
 
 /**
@@ -55,6 +117,39 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ *  @brief  The sched statistics callback
+ *
+ *  Registered by @ref init_schedstatistics, to be called by other scheduler
+ *  callbacks that replace it.
+ *
+ *  @param[in] active_thread    Pid of the active thread
+ *  @param[in] next_thread      Pid of the next scheduled thread
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE) || defined(DOXYGEN)
+/**
+ *  Latency of the sampling timer, see @ref schedstatistics
+ */
+extern schedstat_hist_t sched_irq_latency;
+
+/**
+ *  @brief  Records a thread becoming runnable
+ *
+ *  Called by the scheduler.
+ *
+ *  @param[in] pid      Pid of the thread
+ */
+void sched_statistics_runnable(kernel_pid_t pid);
+
+/**
+ *  @brief  Resets the profiling statistics of all threads and the interrupt
+ *          latency
+ */
+void sched_statistics_reset(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -133,6 +133,28 @@ ssize_t stdio_read(void* buffer, size_t max_len);
  */
 ssize_t stdio_write(const void* buffer, size_t len);
 
+#if IS_USED(MODULE_STDIO_TX_ASYNC) || DOXYGEN
+/**
+ * @brief write @p len bytes from @p buffer into STDOUT right away
+ *
+ * With @ref sys_stdio_tx_async, stdio_write() only buffers the output and
+ * this function writes the buffered output to the stdio backend(s).
+ *
+ * @param[in]   buffer  buffer to read from
+ * @param[in]   len     nr of bytes to write
+ * @return nr of bytes written
+ * @return <0 on error
+ */
+ssize_t stdio_write_blocking(const void* buffer, size_t len);
+
+/**
+ * @brief Name of the function writing to the stdio backend(s)
+ */
+#define STDIO_WRITE_BACKEND     stdio_write_blocking
+#else
+#define STDIO_WRITE_BACKEND     stdio_write
+#endif
+
 /**
  * @brief Disable stdio and detach stdio providers
  */
@@ -167,7 +189,8 @@ void stdio_close(void);
             f();                                            \
         }                                                   \
     }                                                       \
-    ssize_t stdio_write(const void* buffer, size_t len) {   \
+    ssize_t STDIO_WRITE_BACKEND(const void* buffer,         \
+                                size_t len) {               \
         return _write(buffer, len);                         \
     }
 #endif
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_stdio_tx_async Buffered STDIO output
+ * @ingroup     sys_stdio
+ *
+ * @brief       Decouples writing to stdout from the STDIO backend
+ *
+ * With this module, stdio_write() only copies the output into a ring buffer
+ * and returns. A thread of low priority hands the buffered output in chunks
+ * to the STDIO backend, e.g. @ref sys_stdio_uart or `stdio_native`. So
+ * printing from a thread, e.g. with @ref core_util_log, no longer blocks it
+ * for the time it takes to transmit the output.
+ *
+ *     USEMODULE += stdio_tx_async
+ *
+ * When the ring buffer has not enough space for an output,
+ * @ref CONFIG_STDIO_TX_ASYNC_BLOCK selects whether the output is dropped and
+ * counted in @ref stdio_tx_async_stats_t, or whether the writing thread hands
+ * buffered output to the backend itself until everything fits. Output larger
+ * than the whole ring buffer is never dropped, but always handled the latter
+ * way.
+ *
+ * Output from interrupt context, with interrupts disabled (e.g. on a crash),
+ * or before the thread was started is written to the backend right away,
+ * after the buffered output. If this interrupted the backend being handed a
+ * chunk, it is added to the ring buffer instead, or dropped if it does not
+ * fit.
+ *
+ * @note    The backend needs to be provided with @ref STDIO_PROVIDER, so
+ *          `ethos_stdio` and `stdio_fb` are not supported.
+ * @note    Buffered output is lost when the system is reset or powered off.
+ *          Call @ref stdio_tx_async_flush before, if needed.
+ * @note    With @ref sys_stdio_uart on CPUs that provide the
+ *          `periph_uart_nonblocking` feature, the UART driver itself already
+ *          transmits from a buffer in the background.
+ *
+ * @{
+ * @file
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_stdio_tx_async_conf Buffered STDIO output configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Size of the ring buffer for the output in bytes, must be a power
+ *          of two
+ */
+#ifndef CONFIG_STDIO_TX_ASYNC_BUFSIZE
+#define CONFIG_STDIO_TX_ASYNC_BUFSIZE       (512U)
+#endif
+
+/**
+ * @brief   Maximum number of bytes handed to the backend at once
+ */
+#ifndef CONFIG_STDIO_TX_ASYNC_CHUNK_SIZE
+#define CONFIG_STDIO_TX_ASYNC_CHUNK_SIZE    (64U)
+#endif
+
+/**
+ * @brief   Block instead of dropping output, if the ring buffer is full
+ *
+ * Set to 1 to make stdio_write() write buffered output to the backend itself,
+ * until the new output fits into the ring buffer. By default, output that
+ * does not fit as a whole is dropped, unless it is larger than the ring
+ * buffer.
+ */
+#ifndef CONFIG_STDIO_TX_ASYNC_BLOCK
+#define CONFIG_STDIO_TX_ASYNC_BLOCK         0
+#endif
+
+/**
+ * @brief   Priority of the thread writing the buffered output
+ */
+#ifndef CONFIG_STDIO_TX_ASYNC_PRIO
+#define CONFIG_STDIO_TX_ASYNC_PRIO          (THREAD_PRIORITY_IDLE - 1)
+#endif
+
+/**
+ * @brief   Stack size of the thread writing the buffered output
+ */
+#ifndef CONFIG_STDIO_TX_ASYNC_STACKSIZE
+#define CONFIG_STDIO_TX_ASYNC_STACKSIZE     (THREAD_STACKSIZE_SMALL)
+#endif
+/** @} */
+
+/**
+ * @brief   Statistics of the buffered output
+ */
+typedef struct {
+    uint32_t written;   /**< bytes handed to the backend */
+    uint32_t dropped;   /**< bytes dropped, as the ring buffer was full */
+    uint32_t drops;     /**< number of stdio_write() calls dropped */
+} stdio_tx_async_stats_t;
+
+/**
+ * @brief   Writes all buffered output to the backend
+ *
+ * Returns when the ring buffer is empty.
+ */
+void stdio_tx_async_flush(void);
+
+/**
+ * @brief   Gets the statistics of the buffered output
+ *
+ * @param[out] stats    The statistics.
+ */
+void stdio_tx_async_stats(stdio_tx_async_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
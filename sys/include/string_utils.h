@@ -182,6 +182,23 @@ ssize_t strscpy(char *dest, const char *src, size_t count);
  */
 const void *memchk(const void *data, uint8_t c, size_t len);
 
+/**
+ * @brief   Find the first occurrence of either of two bytes in a buffer
+ *
+ * Compares a machine word at a time, which makes skipping over long runs of
+ * other bytes considerably faster than a byte-wise loop. Useful e.g. for
+ * finding the bytes that need escaping in byte-stuffed framings.
+ *
+ * @param[in]   data    The buffer to search
+ * @param[in]   a       The first byte to search for
+ * @param[in]   b       The second byte to search for
+ * @param[in]   len     Size of the buffer
+ *
+ * @return pointer to the first byte equal to @p a or @p b
+ * @return NULL if the buffer contains neither of them
+ */
+const void *memchr2(const void *data, uint8_t a, uint8_t b, size_t len);
+
 /**
  * @brief   Reverse the order of bytes in a buffer
  *
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_suit_transport_pipeline SUIT pipelined payload storage
+ * @ingroup     sys_suit
+ * @brief       Overlap payload download, digest and storage writes
+ *
+ * Without this module the SUIT worker downloads a payload block, writes it to
+ * the storage backend and only then requests the next block. After the
+ * download completes, the whole payload is read back from storage to compute
+ * its SHA-256 digest.
+ *
+ * With `suit_transport_pipeline`, received blocks are copied into one of two
+ * buffers and handed to a dedicated writer thread, so the next block is
+ * fetched while the previous one is still being programmed. The digest is
+ * computed incrementally while the blocks arrive, so the image match
+ * condition does not need to read the payload back from storage.
+ *
+ * If the blocks are not delivered in order, the streamed digest is discarded
+ * and the payload is verified by reading it back from storage as usual. The
+ * same happens on any later check of the component: the streamed digest is
+ * used at most once, for the manifest, component, storage backend and
+ * location it was computed for. It is discarded when the download fails and
+ * when the manifest has been processed.
+ *
+ * @{
+ *
+ * @brief       Pipelined SUIT payload storage
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashes/sha256.h"
+#include "suit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of each of the two pipeline buffers
+ *
+ * Blocks larger than this are split into several writes.
+ */
+#ifndef CONFIG_SUIT_TRANSPORT_PIPELINE_BUFSIZE
+#define CONFIG_SUIT_TRANSPORT_PIPELINE_BUFSIZE  (1024U)
+#endif
+
+/**
+ * @brief   Start pipelining the payload of the current component
+ *
+ * Waits for writes of a previous payload to complete and resets the streamed
+ * digest. The storage backend must have been started already, with the
+ * location of the current component set active.
+ *
+ * @param[in]   manifest    suit manifest context
+ *
+ * @returns     SUIT_OK on success
+ * @returns     negative on error
+ */
+int suit_transport_pipeline_start(const suit_manifest_t *manifest);
+
+/**
+ * @brief   Queue a block of the payload for writing
+ *
+ * The data is copied, so @p buf may be reused as soon as this returns. Blocks
+ * until a pipeline buffer is free.
+ *
+ * @param[in]   manifest    suit manifest context
+ * @param[in]   buf         block of payload data
+ * @param[in]   offset      offset of @p buf in the payload
+ * @param[in]   len         length of @p buf
+ *
+ * @returns     SUIT_OK on success
+ * @returns     negative if this or a previously queued write failed
+ */
+int suit_transport_pipeline_write(const suit_manifest_t *manifest,
+                                  const uint8_t *buf, size_t offset,
+                                  size_t len);
+
+/**
+ * @brief   Wait until all queued blocks are written
+ *
+ * @returns     SUIT_OK if all writes succeeded
+ * @returns     the error of the first failed write otherwise
+ */
+int suit_transport_pipeline_flush(void);
+
+/**
+ * @brief   Discard the streamed digest
+ *
+ * Called when a download fails and when a manifest has been processed.
+ */
+void suit_transport_pipeline_invalidate(void);
+
+/**
+ * @brief   Get the digest computed while the payload was received
+ *
+ * The digest is discarded afterwards, so it can be retrieved only once.
+ *
+ * @param[in]   manifest    suit manifest context, the digest is retrieved for
+ *                          its current component
+ * @param[in]   size        expected payload size
+ * @param[out]  digest      SHA-256 digest of the payload
+ *
+ * @returns     SUIT_OK if @p digest holds the digest of the complete payload
+ * @returns     negative if no streamed digest is available for the
+ *              component, the payload must then be read back from storage
+ */
+int suit_transport_pipeline_digest(const suit_manifest_t *manifest,
+                                   size_t size,
+                                   uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -22,6 +22,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "timex.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -47,6 +49,28 @@ extern "C" {
 #define BENCH_PORT_DEFAULT      (12345)
 #endif
 
+/**
+ * @brief   Maximum number of datagrams sent and received at once by
+ *          @ref benchmark_udp_burst()
+ */
+#ifndef BENCH_BURST_BATCH_MAX
+#define BENCH_BURST_BATCH_MAX   (8)
+#endif
+
+/**
+ * @brief   Size of the datagrams sent by @ref benchmark_udp_burst()
+ */
+#ifndef BENCH_BURST_PAYLOAD_SIZE
+#define BENCH_BURST_PAYLOAD_SIZE    (32)
+#endif
+
+/**
+ * @brief   Time @ref benchmark_udp_burst() waits for outstanding replies in µs
+ */
+#ifndef BENCH_BURST_TIMEOUT_US
+#define BENCH_BURST_TIMEOUT_US  (100U * US_PER_MS)
+#endif
+
 /**
  * @brief   Flag indicating the benchmark packet is a configuration command.
  */
@@ -104,6 +128,35 @@ int benchmark_udp_start(const char *server, uint16_t port);
  */
 bool benchmark_udp_stop(void);
 
+/**
+ * @brief   Sends datagrams to the server as fast as possible and receives the
+ *          replies, to measure the throughput of the network stack
+ *
+ * Sends @p batch datagrams and waits for their replies, until @p count
+ * datagrams were sent. With @p many, the datagrams of a batch are sent with
+ * one call to @ref sock_udp_send_many() and received with
+ * @ref sock_udp_recv_many(). Otherwise, they are sent with back-to-back
+ * calls to @ref sock_udp_send() and received with @ref sock_udp_recv(), so
+ * both variants have the same number of datagrams in flight. A running
+ * benchmark process is stopped first.
+ *
+ * The datagrams are sent from @p port, so with an address of the node
+ * itself as @p server, they are received as their own replies.
+ *
+ * @param[in]   server  benchmark server (address or hostname)
+ * @param[in]   port    benchmark server port
+ * @param[in]   count   number of datagrams to send
+ * @param[in]   batch   number of datagrams to send at once,
+ *                      1 to @ref BENCH_BURST_BATCH_MAX
+ * @param[in]   many    use @ref sock_udp_send_many() and
+ *                      @ref sock_udp_recv_many()
+ *
+ * @return      0 on success
+ *              error otherwise
+ */
+int benchmark_udp_burst(const char *server, uint16_t port, unsigned count,
+                        unsigned batch, bool many);
+
 #ifdef __cplusplus
 }
 #endif
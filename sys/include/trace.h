@@ -28,10 +28,12 @@
  * The trace buffer works like a ring-buffer. If it is full, it will start
  * overwriting from the beginning.
  *
- * Tracing is made thread safe by disabling interrupts for critical sections.
+ * Tracing is lock-free: an entry is reserved with a single atomic increment,
+ * so recording never disables interrupts (on platforms with atomic
+ * instructions).
  *
  * It does incur some overhead (at least a function call, getting the current
- * time, a pair of enable/disable interrupts and a couple of memory accesses).
+ * time and a couple of memory accesses).
  *
  * Example:
  *
@@ -43,6 +45,34 @@
  * trace_dump();
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Events
+ * ------
+ *
+ * Besides values passed to `trace()`, every entry records an event ID from
+ * @ref trace_event_t and the thread that was running. The following
+ * pseudomodules record events of RIOT itself:
+ *
+ * - `trace_sched`: context switches, using @ref sched_register_cb
+ * - `trace_msg`: sent and received messages
+ * - `trace_mutex`: locked, contended and unlocked mutexes
+ * - `trace_netif`: packets sent and received by GNRC network interfaces
+ *
+ * Applications use IDs from @ref TRACE_EV_APP on with `trace_event()`.
+ * There is no generic interrupt entry hook in RIOT, so ISRs of interest have
+ * to be instrumented with @ref trace_isr_enter and @ref trace_isr_exit.
+ *
+ * Export
+ * ------
+ *
+ * `trace_export()` writes the trace buffer in a compact binary format, e.g.
+ * to `trace_export_stdio()`, which prints it hex encoded, or on `native` to a
+ * host file with `trace_export_file()`. `dist/tools/trace/trace_decode.py`
+ * converts both into human readable text or into a JSON trace that can be
+ * opened with https://ui.perfetto.dev:
+ *
+ *     make term | tee trace.log
+ *     dist/tools/trace/trace_decode.py -f perfetto trace.log > trace.json
+ *
  * @{
  *
  * @brief       Execution tracing module API
@@ -52,12 +82,102 @@
  *
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Event IDs
+ *
+ * The meaning of the pid and the argument of an entry depends on the event.
+ * Unless noted otherwise, the pid is the one of the thread that was running.
+ */
+typedef enum {
+    TRACE_EV_USER = 0,          /**< `trace()`, argument is the value */
+    TRACE_EV_THREAD_SWITCH,     /**< pid is the thread switched from (0 if
+                                     none), argument the thread switched to */
+    TRACE_EV_ISR_ENTER,         /**< argument is the IRQ number */
+    TRACE_EV_ISR_EXIT,          /**< argument is the IRQ number */
+    TRACE_EV_MSG_SEND,          /**< argument is the target pid << 16 |
+                                     the message type */
+    TRACE_EV_MSG_RECV,          /**< argument is the sender pid << 16 |
+                                     the message type */
+    TRACE_EV_MUTEX_LOCK,        /**< argument is the mutex address */
+    TRACE_EV_MUTEX_BLOCK,       /**< mutex is locked, thread waits for it,
+                                     argument is the mutex address */
+    TRACE_EV_MUTEX_UNLOCK,      /**< argument is the mutex address */
+    TRACE_EV_NETIF_SEND,        /**< argument is the interface pid << 16 |
+                                     the packet length */
+    TRACE_EV_NETIF_RECV,        /**< argument is the interface pid << 16 |
+                                     the packet length */
+    TRACE_EV_APP = 0x80,        /**< first ID free for applications */
+} trace_event_t;
+
+/**
+ * @brief   Flag of an entry recorded in interrupt context
+ */
+#define TRACE_FLAG_ISR          (0x01)
+
+/**
+ * @brief   Trace buffer entry, as exported by `trace_export()`
+ */
+typedef struct {
+    uint32_t time;      /**< time stamp in microseconds */
+    uint32_t arg;       /**< argument of the event */
+    uint8_t id;         /**< event ID, see @ref trace_event_t */
+    uint8_t pid;        /**< pid of the running thread, 0 if none */
+    uint8_t flags;      /**< e.g. @ref TRACE_FLAG_ISR */
+    uint8_t reserved;   /**< reserved, 0 */
+} trace_entry_t;
+
+/**
+ * @brief   Magic number at the start of the binary export
+ */
+#define TRACE_EXPORT_MAGIC      "RTRC"
+
+/**
+ * @brief   Version of the binary export format
+ */
+#define TRACE_EXPORT_VERSION    (1U)
+
+/**
+ * @brief   Header of the binary export
+ *
+ * The header is followed by @ref trace_export_hdr_t::threads entries of
+ * @ref trace_export_thread_t and @ref trace_export_hdr_t::entries entries of
+ * @ref trace_entry_t, oldest first. All fields are in the byte order of the
+ * exporting CPU, as indicated by @ref trace_export_hdr_t::byteorder.
+ */
+typedef struct {
+    char magic[4];          /**< @ref TRACE_EXPORT_MAGIC */
+    uint8_t version;        /**< @ref TRACE_EXPORT_VERSION */
+    uint8_t entry_size;     /**< `sizeof(trace_entry_t)` */
+    uint8_t threads;        /**< number of thread entries */
+    uint8_t byteorder;      /**< 0 for little endian, 1 for big endian */
+    uint32_t entries;       /**< number of entries */
+    uint32_t lost;          /**< number of entries overwritten */
+} trace_export_hdr_t;
+
+/**
+ * @brief   Thread entry of the binary export
+ */
+typedef struct {
+    uint8_t pid;            /**< pid of the thread */
+    char name[15];          /**< name of the thread, may not be terminated */
+} trace_export_thread_t;
+
+/**
+ * @brief   Function to write a part of the binary export
+ *
+ * @param[in]   data    data to write
+ * @param[in]   len     length of @p data
+ * @param[in]   arg     argument passed to `trace_export()`
+ */
+typedef void (*trace_write_cb_t)(const void *data, size_t len, void *arg);
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -72,12 +192,43 @@ extern "C" {
  */
 void trace(uint32_t val);
 
+/**
+ * @brief   Add an event to the trace buffer
+ *
+ * Safe to call from anywhere, like `trace()`.
+ *
+ * @param[in]   id      event ID, see @ref trace_event_t
+ * @param[in]   arg     argument of the event
+ */
+void trace_event(uint8_t id, uint32_t arg);
+
+/**
+ * @brief   Record entering an interrupt service routine
+ *
+ * @param[in]   irq     IRQ number
+ */
+static inline void trace_isr_enter(unsigned irq)
+{
+    trace_event(TRACE_EV_ISR_ENTER, irq);
+}
+
+/**
+ * @brief   Record leaving an interrupt service routine
+ *
+ * @param[in]   irq     IRQ number
+ */
+static inline void trace_isr_exit(unsigned irq)
+{
+    trace_event(TRACE_EV_ISR_EXIT, irq);
+}
+
 /**
  * @brief   Print the current trace buffer
  *
  * Will print the number of the trace log entry, the timestamp (first entry) or
  * relative time since last entry, and the value supplied to the `trace()` call
- * of each entry.
+ * of each entry. Entries of other events than `trace()` are followed by the
+ * event ID and the pid.
  *
  * Example output (after adding two traces, 3us apart, with values 0 and 1):
  *
@@ -86,6 +237,38 @@ void trace(uint32_t val);
  */
 void trace_dump(void);
 
+/**
+ * @brief   Write the trace buffer in the binary export format
+ *
+ * Recording is paused while exporting, events in between are not recorded.
+ *
+ * @param[in]   write   function to write the export with
+ * @param[in]   arg     argument for @p write
+ */
+void trace_export(trace_write_cb_t write, void *arg);
+
+/**
+ * @brief   Print the binary export of the trace buffer hex encoded
+ *
+ * The export is printed in lines starting with `trace: `, framed by the lines
+ * `trace: begin` and `trace: end`.
+ */
+void trace_export_stdio(void);
+
+#if defined(CPU_NATIVE) || defined(DOXYGEN)
+/**
+ * @brief   Write the binary export of the trace buffer to a host file
+ *
+ * @note    Only available on `native`
+ *
+ * @param[in]   path    path of the file on the host, will be overwritten
+ *
+ * @return  0 on success
+ * @return  -errno on error
+ */
+int trace_export_file(const char *path);
+#endif
+
 /**
  * @brief   Empty the trace buffer
  */
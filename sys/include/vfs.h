@@ -52,6 +52,7 @@
  * @author  Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <sys/stat.h> /* for struct stat */
 #include <sys/types.h> /* for off_t etc. */
@@ -408,6 +409,22 @@ typedef struct {
     } private_data;             /**< File system driver private data, implementation defined */
 } vfs_file_t;
 
+/**
+ * @brief Buffer of a file in buffered mode
+ *
+ * @see vfs_setvbuf
+ *
+ * @attention This structure should be treated as an opaque blob and must not be
+ * modified by user code while it is attached to a file.
+ */
+typedef struct {
+    uint8_t *data;  /**< buffer space */
+    size_t size;    /**< size of @ref data */
+    size_t len;     /**< number of valid bytes in @ref data */
+    size_t pos;     /**< number of bytes of @ref data already read */
+    bool dirty;     /**< @ref data holds bytes not yet written to the file */
+} vfs_file_buffer_t;
+
 /**
  * @brief Internal representation of a file system directory entry
  *
@@ -903,6 +920,35 @@ ssize_t vfs_write_iol(int fd, const iolist_t *iolist);
  */
 int vfs_fsync(int fd);
 
+/**
+ * @brief Enable buffering for an open file
+ *
+ * Only available with the `vfs_buffered` module.
+ *
+ * Reads from the file driver are done in chunks of @p size bytes, so
+ * subsequent small reads (including @ref vfs_readline) are served from
+ * @p buf. Small writes are collected in @p buf and passed to the file driver
+ * when the buffer is full, on @ref vfs_fsync, @ref vfs_lseek,
+ * @ref vfs_fstat, @ref vfs_close or when switching between reading and
+ * writing. Reads and writes of at least @p size bytes bypass the buffer.
+ *
+ * The buffer only works for files that support seeking, as unused read-ahead
+ * data is given back by seeking backwards before writing.
+ *
+ * Calling this function again flushes the previous buffer, passing NULL as
+ * @p fbuf disables buffering.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] fbuf     buffer state, must stay valid until the file is closed
+ *                      or buffering is disabled
+ * @param[in]  buf      buffer space
+ * @param[in]  size     size of @p buf
+ *
+ * @return 0 on success
+ * @return <0 on error, this includes errors writing out the previous buffer
+ */
+int vfs_setvbuf(int fd, vfs_file_buffer_t *fbuf, void *buf, size_t size);
+
 /**
  * @brief Open a directory for reading with readdir
  *
@@ -17,6 +17,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <errno.h>
+#include "architecture.h"
 #include "string_utils.h"
 
 ssize_t strscpy(char *dest, const char *src, size_t count)
@@ -52,6 +53,49 @@ const void *memchk(const void *data, uint8_t c, size_t len)
     return NULL;
 }
 
+/* non-zero, if any byte of @p word is zero */
+static inline uword_t _has_zero_byte(uword_t word)
+{
+    const uword_t ones = UWORD_MAX / 0xff;
+
+    return (word - ones) & ~word & (ones << 7);
+}
+
+const void *memchr2(const void *data, uint8_t a, uint8_t b, size_t len)
+{
+    const uint8_t *d = data;
+    const uint8_t *end = d + len;
+
+    /* byte-wise up to the first aligned word */
+    for (; (d != end) && ((uintptr_t)d % sizeof(uword_t)); d++) {
+        if ((*d == a) || (*d == b)) {
+            return d;
+        }
+    }
+
+    const uword_t pattern_a = (UWORD_MAX / 0xff) * a;
+    const uword_t pattern_b = (UWORD_MAX / 0xff) * b;
+
+    /* skip all words that contain neither of the bytes */
+    for (; (size_t)(end - d) >= sizeof(uword_t); d += sizeof(uword_t)) {
+        uword_t word;
+
+        memcpy(&word, d, sizeof(word));
+        if (_has_zero_byte(word ^ pattern_a) ||
+            _has_zero_byte(word ^ pattern_b)) {
+            break;
+        }
+    }
+
+    for (; d != end; d++) {
+        if ((*d == a) || (*d == b)) {
+            return d;
+        }
+    }
+
+    return NULL;
+}
+
 int __swprintf(string_writer_t *sw, FLASH_ATTR const char *restrict format, ...)
 {
     va_list args;
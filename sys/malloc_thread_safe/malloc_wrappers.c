@@ -16,6 +16,9 @@
  * @author  Marian Buschsieweke <marian.buschsieweke@ovgu.de>
  */
 
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -25,7 +28,10 @@
 #include "irq.h"
 #include "kernel_defines.h"
 #include "malloc_monitor_internal.h"
+#include "malloc_thread_safe.h"
+#include "memarray.h"
 #include "mutex.h"
+#include "thread.h"
 
 extern void *__real_malloc(size_t size);
 extern void __real_free(void *ptr);
@@ -33,9 +39,191 @@ extern void *__real_realloc(void *ptr, size_t size);
 
 static mutex_t _lock;
 
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+#define CLASSES         CONFIG_MALLOC_THREAD_SAFE_CACHE_CLASSES
+#define BLOCKS          CONFIG_MALLOC_THREAD_SAFE_CACHE_BLOCKS
+#define DEPTH           CONFIG_MALLOC_THREAD_SAFE_CACHE_DEPTH
+/* number of blocks moved from or to the shared pool at once */
+#define BATCH           ((DEPTH + 1) / 2)
+#define CLASS_SIZE(c)   (CONFIG_MALLOC_THREAD_SAFE_CACHE_MIN_SIZE << (c))
+/* the pools of the size classes are laid out in ascending order */
+#define POOL_OFFSET(c)  (BLOCKS * CONFIG_MALLOC_THREAD_SAFE_CACHE_MIN_SIZE * \
+                         ((1U << (c)) - 1))
+
+static_assert((CONFIG_MALLOC_THREAD_SAFE_CACHE_MIN_SIZE %
+               alignof(max_align_t)) == 0,
+              "size classes must keep the alignment of malloc()");
+static_assert(CONFIG_MALLOC_THREAD_SAFE_CACHE_MIN_SIZE >= sizeof(void *),
+              "size classes must fit a pointer");
+static_assert((DEPTH > 0) && (DEPTH <= UINT8_MAX),
+              "CONFIG_MALLOC_THREAD_SAFE_CACHE_DEPTH out of range");
+
+typedef struct {
+    void *head;             /* free blocks, linked through their first word */
+    uint8_t count;
+} _cache_t;
+
+static alignas(max_align_t) uint8_t _pool[POOL_OFFSET(CLASSES)];
+/* free blocks not owned by any thread, guarded by _lock */
+static memarray_t _shared[CLASSES];
+/* only ever accessed by the thread owning the PID, hence without locking */
+static _cache_t _caches[MAXTHREADS][CLASSES];
+static malloc_thread_safe_cache_stats_t _stats;
+
+static void _pool_init(void)
+{
+    for (unsigned c = 0; c < CLASSES; c++) {
+        memarray_init(&_shared[c], &_pool[POOL_OFFSET(c)], CLASS_SIZE(c),
+                      BLOCKS);
+    }
+}
+
+static bool _in_pool(const void *ptr)
+{
+    return ((uintptr_t)ptr >= (uintptr_t)_pool) &&
+           ((uintptr_t)ptr < (uintptr_t)_pool + sizeof(_pool));
+}
+
+static unsigned _class_of_size(size_t size)
+{
+    unsigned c = 0;
+
+    while (CLASS_SIZE(c) < size) {
+        c++;
+    }
+    return c;
+}
+
+static unsigned _class_of_block(const void *ptr)
+{
+    size_t offset = (uintptr_t)ptr - (uintptr_t)_pool;
+    unsigned c = CLASSES - 1;
+
+    while (offset < POOL_OFFSET(c)) {
+        c--;
+    }
+    return c;
+}
+
+static _cache_t *_own_cache(unsigned c)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    /* e.g. C++ constructors may allocate before the first thread runs */
+    if (!pid_is_valid(pid)) {
+        return NULL;
+    }
+    return &_caches[pid - KERNEL_PID_FIRST][c];
+}
+
+static void _push(_cache_t *cache, void *block)
+{
+    memcpy(block, &cache->head, sizeof(void *));
+    cache->head = block;
+    cache->count++;
+}
+
+static void *_pop(_cache_t *cache)
+{
+    void *block = cache->head;
+
+    memcpy(&cache->head, block, sizeof(void *));
+    cache->count--;
+    return block;
+}
+
+static void *_cache_alloc(size_t size)
+{
+    unsigned c = _class_of_size(size);
+    _cache_t *cache = _own_cache(c);
+
+    if (cache && cache->head) {
+        return _pop(cache);
+    }
+
+    mutex_lock(&_lock);
+    if (_shared[c].size == 0) {
+        _pool_init();
+    }
+    _stats.locked++;
+    void *ptr = memarray_alloc(&_shared[c]);
+    /* take a batch, so that the next allocations don't need the lock */
+    for (unsigned i = 1; ptr && cache && (i < BATCH); i++) {
+        void *block = memarray_alloc(&_shared[c]);
+        if (block == NULL) {
+            break;
+        }
+        _push(cache, block);
+    }
+    if (ptr == NULL) {
+        _stats.fallbacks++;
+        ptr = __real_malloc(size);
+    }
+    mutex_unlock(&_lock);
+
+    return ptr;
+}
+
+static void _cache_free(void *ptr)
+{
+    unsigned c = _class_of_block(ptr);
+    _cache_t *cache = _own_cache(c);
+
+    if (cache && (cache->count < DEPTH)) {
+        _push(cache, ptr);
+        return;
+    }
+
+    mutex_lock(&_lock);
+    _stats.locked++;
+    memarray_free(&_shared[c], ptr);
+    /* hand back a batch, keep the rest for the next allocations */
+    while (cache && (cache->count > DEPTH - BATCH)) {
+        memarray_free(&_shared[c], _pop(cache));
+    }
+    mutex_unlock(&_lock);
+}
+
+void malloc_thread_safe_cache_flush(void)
+{
+    assert(!irq_is_in());
+    mutex_lock(&_lock);
+    for (unsigned c = 0; c < CLASSES; c++) {
+        _cache_t *cache = _own_cache(c);
+
+        while (cache && cache->head) {
+            memarray_free(&_shared[c], _pop(cache));
+        }
+    }
+    mutex_unlock(&_lock);
+}
+
+void malloc_thread_safe_cache_stats(malloc_thread_safe_cache_stats_t *stats)
+{
+    assert(!irq_is_in());
+    mutex_lock(&_lock);
+    *stats = _stats;
+    mutex_unlock(&_lock);
+}
+
+static bool _cached(size_t size)
+{
+    return (size > 0) && (size <= CLASS_SIZE(CLASSES - 1));
+}
+#endif
+
 void __attribute__((used)) *__wrap_malloc(size_t size)
 {
     assert(!irq_is_in());
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    if (_cached(size)) {
+        void *ptr = _cache_alloc(size);
+        if (IS_USED(MODULE_MALLOC_MONITOR)) {
+            malloc_monitor_add(ptr, size, cpu_get_caller_pc(), "m");
+        }
+        return ptr;
+    }
+#endif
     mutex_lock(&_lock);
     void *ptr = __real_malloc(size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
@@ -48,6 +236,16 @@ void __attribute__((used)) *__wrap_malloc(size_t size)
 void __attribute__((used)) __wrap_free(void *ptr)
 {
     assert(!irq_is_in());
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    if (_in_pool(ptr)) {
+        /* the block may be handed out again as soon as it is freed */
+        if (IS_USED(MODULE_MALLOC_MONITOR)) {
+            malloc_monitor_rm(ptr, cpu_get_caller_pc());
+        }
+        _cache_free(ptr);
+        return;
+    }
+#endif
     mutex_lock(&_lock);
     __real_free(ptr);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
@@ -66,6 +264,19 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
         return NULL;
     }
 
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    if (_cached(total_size)) {
+        void *res = _cache_alloc(total_size);
+        if (IS_USED(MODULE_MALLOC_MONITOR)) {
+            malloc_monitor_add(res, total_size, cpu_get_caller_pc(), "c");
+        }
+        if (res) {
+            memset(res, 0, total_size);
+        }
+        return res;
+    }
+#endif
+
     mutex_lock(&_lock);
     void *res = __real_malloc(total_size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
@@ -82,6 +293,45 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
 void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
 {
     assert(!irq_is_in());
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    if ((ptr == NULL) && _cached(size)) {
+        void *new = _cache_alloc(size);
+        if (IS_USED(MODULE_MALLOC_MONITOR)) {
+            malloc_monitor_add(new, size, cpu_get_caller_pc(), "re");
+        }
+        return new;
+    }
+    if (_in_pool(ptr)) {
+        size_t old_size = CLASS_SIZE(_class_of_block(ptr));
+        void *new = ptr;
+
+        if (size == 0) {
+            new = NULL;
+        }
+        else if (size > old_size) {
+            if (_cached(size)) {
+                new = _cache_alloc(size);
+            }
+            else {
+                mutex_lock(&_lock);
+                new = __real_malloc(size);
+                mutex_unlock(&_lock);
+            }
+            if (new == NULL) {
+                /* the old block stays valid */
+                return NULL;
+            }
+            memcpy(new, ptr, old_size);
+        }
+        if (IS_USED(MODULE_MALLOC_MONITOR)) {
+            malloc_monitor_mv(ptr, new, size, cpu_get_caller_pc());
+        }
+        if (new != ptr) {
+            _cache_free(ptr);
+        }
+        return new;
+    }
+#endif
     mutex_lock(&_lock);
     void *new = __real_realloc(ptr, size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
@@ -39,6 +39,32 @@ void memarray_extend(memarray_t *mem, void *data, size_t num)
     }
 }
 
+size_t memarray_alloc_n(memarray_t *mem, void **ptrs, size_t num)
+{
+    assert((mem != NULL) && (ptrs != NULL));
+
+    void *free = mem->free_data;
+
+    for (size_t i = 0; i < num; i++) {
+        if (free == NULL) {
+            return 0;
+        }
+        ptrs[i] = free;
+        memcpy(&free, free, sizeof(void *));
+    }
+    mem->free_data = free;
+    return num;
+}
+
+void memarray_free_n(memarray_t *mem, void * const *ptrs, size_t num)
+{
+    assert((mem != NULL) && (ptrs != NULL));
+
+    for (size_t i = 0; i < num; i++) {
+        memarray_free(mem, ptrs[i]);
+    }
+}
+
 static bool _in_pool(const memarray_t *mem, const void *data, size_t num,
                      const void *element)
 {
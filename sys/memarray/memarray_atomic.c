@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_memarray
+ * @{
+ *
+ * @file
+ * @brief       Lock-free memory array allocator implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "memarray_atomic.h"
+
+/* the lower half of the head is the index + 1 of the first free block, the
+ * upper half a tag that changes whenever the head is written, so that a
+ * compare and swap fails if the list was changed in between (ABA problem) */
+#define INDEX_MASK      (0xffffU)
+#define TAG_INC         (0x10000U)
+
+static inline void *_block(const memarray_atomic_t *mem, unsigned idx)
+{
+    return mem->data + (idx - 1) * mem->size;
+}
+
+static inline unsigned _index(const memarray_atomic_t *mem, const void *ptr)
+{
+    assert(((const uint8_t *)ptr >= mem->data) &&
+           ((const uint8_t *)ptr < mem->data + mem->num * mem->size));
+
+    return ((const uint8_t *)ptr - mem->data) / mem->size + 1;
+}
+
+/* the link may be read while the block is concurrently handed out and
+ * written to, a torn value is caught by the compare and swap of the head */
+static inline unsigned _next(const void *block)
+{
+    return atomic_load_explicit((const atomic_uint_least16_t *)block,
+                                memory_order_relaxed);
+}
+
+static inline void _set_next(void *block, unsigned idx)
+{
+    atomic_store_explicit((atomic_uint_least16_t *)block, idx,
+                          memory_order_relaxed);
+}
+
+void memarray_atomic_init(memarray_atomic_t *mem, void *data, size_t size,
+                          size_t num)
+{
+    assert((mem != NULL) && (data != NULL) && (num != 0) &&
+           (num <= MEMARRAY_ATOMIC_MAX) && (size >= sizeof(uint16_t)) &&
+           ((size % sizeof(uint16_t)) == 0));
+
+    mem->data = data;
+    mem->size = size;
+    mem->num = num;
+    for (unsigned idx = 1; idx <= num; idx++) {
+        _set_next(_block(mem, idx), (idx < num) ? idx + 1 : 0);
+    }
+    atomic_init(&mem->used, 0);
+    atomic_init(&mem->max_used, 0);
+    atomic_init(&mem->head, 1);
+}
+
+/* walks @p num blocks down from @p head, returns the index of the block
+ * after them in @p rest, or false if the list ended before */
+static bool _walk(const memarray_atomic_t *mem, uint32_t head, void **ptrs,
+                  size_t num, unsigned *rest)
+{
+    unsigned idx = head & INDEX_MASK;
+
+    for (size_t i = 0; i < num; i++) {
+        /* an index out of range can only be read from a block that was
+         * allocated concurrently, the head has changed then */
+        if ((idx == 0) || (idx > mem->num)) {
+            return false;
+        }
+        ptrs[i] = _block(mem, idx);
+        idx = _next(ptrs[i]);
+    }
+    *rest = idx;
+    return true;
+}
+
+static void _update_used(memarray_atomic_t *mem, unsigned num)
+{
+    unsigned used = atomic_fetch_add_explicit(&mem->used, num,
+                                              memory_order_relaxed) + num;
+    uint_least16_t max = atomic_load_explicit(&mem->max_used,
+                                              memory_order_relaxed);
+
+    while ((used > max) &&
+           !atomic_compare_exchange_weak_explicit(&mem->max_used, &max, used,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {}
+}
+
+size_t memarray_atomic_alloc_n(memarray_atomic_t *mem, void **ptrs,
+                               size_t num)
+{
+    assert((mem != NULL) && (ptrs != NULL));
+
+    if ((num == 0) || (num > mem->num)) {
+        return 0;
+    }
+
+    uint32_t head = atomic_load_explicit(&mem->head, memory_order_acquire);
+    unsigned rest;
+
+    while (1) {
+        if (!_walk(mem, head, ptrs, num, &rest)) {
+            uint32_t now = atomic_load_explicit(&mem->head,
+                                                memory_order_acquire);
+            if (now == head) {
+                /* the list really is too short */
+                return 0;
+            }
+            head = now;
+            continue;
+        }
+        uint32_t next = ((head + TAG_INC) & ~INDEX_MASK) | rest;
+        if (atomic_compare_exchange_weak_explicit(&mem->head, &head, next,
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            break;
+        }
+    }
+
+    _update_used(mem, num);
+    return num;
+}
+
+void memarray_atomic_free_n(memarray_atomic_t *mem, void * const *ptrs,
+                            size_t num)
+{
+    assert((mem != NULL) && (ptrs != NULL));
+
+    if (num == 0) {
+        return;
+    }
+
+    /* chain the blocks, only the link of the last one depends on the head */
+    for (size_t i = 0; i < num - 1; i++) {
+        _set_next(ptrs[i], _index(mem, ptrs[i + 1]));
+    }
+
+    /* count the blocks as free first, so that the number of used blocks
+     * never exceeds the size of the pool */
+    atomic_fetch_sub_explicit(&mem->used, num, memory_order_relaxed);
+
+    uint32_t first = _index(mem, ptrs[0]);
+    uint32_t head = atomic_load_explicit(&mem->head, memory_order_relaxed);
+    uint32_t next;
+
+    do {
+        _set_next(ptrs[num - 1], head & INDEX_MASK);
+        next = ((head + TAG_INC) & ~INDEX_MASK) | first;
+    } while (!atomic_compare_exchange_weak_explicit(&mem->head, &head, next,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
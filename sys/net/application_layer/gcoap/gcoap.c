@@ -299,6 +299,8 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
             DEBUG("gcoap: DTLS recv failure: %" PRIdSIZE "\n", res);
             return;
         }
+        /* keep the session from being evicted while the peer is active */
+        dsm_refresh(sock, &socket.ctx_dtls_session);
         sock_udp_ep_t ep;
         sock_dtls_session_get_udp_ep(&socket.ctx_dtls_session, &ep);
         /* Truncated DTLS messages would already have gotten lost at verification */
@@ -312,13 +314,24 @@ static void _dtls_free_up_session(void *arg) {
     sock_dtls_session_t session;
 
     uint8_t minimum_free = CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS;
-    if (dsm_get_num_available_slots() < minimum_free) {
-        if (dsm_get_least_recently_used_session(&_sock_dtls, &session) != -1) {
-            /* free up session */
-            dsm_remove(&_sock_dtls, &session);
-            sock_dtls_session_destroy(&_sock_dtls, &session);
+    if (dsm_get_num_available_slots() >= minimum_free) {
+        return;
+    }
+    /* evicting a session in use only forces the peer to a new handshake, so
+     * wait for one to become idle unless no slot is left at all */
+    if (dsm_evict_idle_session(&_sock_dtls, &session,
+                               CONFIG_GCOAP_DTLS_SESSION_IDLE_SEC) == -1) {
+        if (dsm_get_num_available_slots() > 0) {
+            event_timeout_set(&_dtls_session_free_up_tmout,
+                              CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_MSEC);
+            return;
+        }
+        if (dsm_evict_idle_session(&_sock_dtls, &session, 0) == -1) {
+            return;
         }
     }
+    /* free up session */
+    sock_dtls_session_destroy(&_sock_dtls, &session);
 }
 #endif /* MODULE_GCOAP_DTLS */
 
@@ -1346,6 +1359,7 @@ static ssize_t _tl_authenticate(gcoap_socket_t *sock, const sock_udp_ep_t *remot
     dsm_state_t session_state = dsm_store(sock->socket.dtls, &sock->ctx_dtls_session,
                                           SESSION_STATE_HANDSHAKE, true);
     if (session_state == SESSION_STATE_ESTABLISHED) {
+        dsm_count_restored();
         return 0;
     }
     if (session_state == NO_SPACE) {
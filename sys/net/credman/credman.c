@@ -16,12 +16,14 @@
  * @author  Aiman Ismail <muhammadaimanbin.ismail@haw-hamburg.de>
  */
 
+#include "hashes.h"
 #include "kernel_defines.h"
 #include "mutex.h"
 #include "net/credman.h"
 #include "string_utils.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include <inttypes.h>
 
@@ -47,6 +49,48 @@ static int _parse_ecc_point(const asn1_tree *key, const void **x, const void **y
 static credman_credential_t credentials[CONFIG_CREDMAN_MAX_CREDENTIALS];
 static unsigned used = 0;
 
+#define CREDMAN_BUCKETS     (CONFIG_CREDMAN_MAX_CREDENTIALS)
+
+/* Chained hash table over the credential pool. Chains hold positions + 1 in
+ * the pool, so that 0 ends a chain. */
+typedef struct {
+    uint16_t bucket[CREDMAN_BUCKETS];
+    uint16_t next[CONFIG_CREDMAN_MAX_CREDENTIALS];
+    uint32_t hash[CONFIG_CREDMAN_MAX_CREDENTIALS];
+} _index_t;
+
+/* all credentials by tag, PSK credentials by identity and by identity hint */
+static _index_t _tag_index;
+static _index_t _psk_id_index;
+static _index_t _psk_hint_index;
+
+static void _index_add(_index_t *idx, unsigned pos, uint32_t hash)
+{
+    unsigned b = hash % CREDMAN_BUCKETS;
+
+    idx->hash[pos] = hash;
+    idx->next[pos] = idx->bucket[b];
+    idx->bucket[b] = pos + 1;
+}
+
+static void _index_remove(_index_t *idx, unsigned pos)
+{
+    uint16_t *link = &idx->bucket[idx->hash[pos] % CREDMAN_BUCKETS];
+
+    while (*link) {
+        if (*link == pos + 1) {
+            *link = idx->next[pos];
+            return;
+        }
+        link = &idx->next[*link - 1];
+    }
+}
+
+static inline bool _has_buffer(const credman_buffer_t *buf)
+{
+    return (buf->s != NULL) && (buf->len != 0);
+}
+
 static int _find_credential_pos(credman_tag_t tag, credman_type_t type,
                                 credman_credential_t **empty);
 
@@ -100,6 +144,18 @@ int credman_add(const credman_credential_t *credential)
     else {
         *entry = *credential;
         used++;
+
+        pos = entry - credentials;
+        _index_add(&_tag_index, pos, credential->tag);
+        if (credential->type == CREDMAN_TYPE_PSK) {
+            const psk_params_t *psk = &credential->params.psk;
+            if (_has_buffer(&psk->id)) {
+                _index_add(&_psk_id_index, pos, djb2_hash(psk->id.s, psk->id.len));
+            }
+            if (_has_buffer(&psk->hint)) {
+                _index_add(&_psk_hint_index, pos, djb2_hash(psk->hint.s, psk->hint.len));
+            }
+        }
         ret = CREDMAN_OK;
     }
 end:
@@ -391,11 +447,69 @@ int credman_get(credman_credential_t *credential, credman_tag_t tag,
     return ret;
 }
 
+static int _get_psk(credman_credential_t *credential, const credman_tag_t *tags,
+                    size_t tags_len, const void *s, size_t len, bool hint)
+{
+    assert(credential && (tags || !tags_len) && s);
+
+    const _index_t *idx = hint ? &_psk_hint_index : &_psk_id_index;
+    uint32_t hash = djb2_hash(s, len);
+    size_t best = tags_len;
+    int pos = -1;
+
+    mutex_lock(&_mutex);
+    for (unsigned p = idx->bucket[hash % CREDMAN_BUCKETS]; p; p = idx->next[p - 1]) {
+        const credman_credential_t *c = &credentials[p - 1];
+        const credman_buffer_t *buf = hint ? &c->params.psk.hint : &c->params.psk.id;
+
+        if ((idx->hash[p - 1] != hash) || (buf->len != len) || memcmp(buf->s, s, len)) {
+            continue;
+        }
+        /* of several matches, take the one whose tag comes first in tags */
+        for (size_t i = 0; i < best; i++) {
+            if (tags[i] == c->tag) {
+                best = i;
+                pos = p - 1;
+                break;
+            }
+        }
+    }
+
+    int ret = CREDMAN_NOT_FOUND;
+    if (pos >= 0) {
+        memcpy(credential, &credentials[pos], sizeof(credman_credential_t));
+        ret = CREDMAN_OK;
+    }
+    mutex_unlock(&_mutex);
+    return ret;
+}
+
+int credman_get_psk_by_id(credman_credential_t *credential, const credman_tag_t *tags,
+                          size_t tags_len, const void *id, size_t id_len)
+{
+    return _get_psk(credential, tags, tags_len, id, id_len, false);
+}
+
+int credman_get_psk_by_hint(credman_credential_t *credential, const credman_tag_t *tags,
+                            size_t tags_len, const void *hint, size_t hint_len)
+{
+    return _get_psk(credential, tags, tags_len, hint, hint_len, true);
+}
+
 void credman_delete(credman_tag_t tag, credman_type_t type)
 {
     mutex_lock(&_mutex);
     int pos = _find_credential_pos(tag, type, NULL);
     if (pos >= 0) {
+        _index_remove(&_tag_index, pos);
+        if (type == CREDMAN_TYPE_PSK) {
+            if (_has_buffer(&credentials[pos].params.psk.id)) {
+                _index_remove(&_psk_id_index, pos);
+            }
+            if (_has_buffer(&credentials[pos].params.psk.hint)) {
+                _index_remove(&_psk_hint_index, pos);
+            }
+        }
         explicit_bzero(&credentials[pos], sizeof(credman_credential_t));
         used--;
     }
@@ -410,15 +524,19 @@ int credman_get_used_count(void)
 static int _find_credential_pos(credman_tag_t tag, credman_type_t type,
                                 credman_credential_t **empty)
 {
-    for (unsigned i = 0; i < CONFIG_CREDMAN_MAX_CREDENTIALS; i++) {
-        credman_credential_t *c = &credentials[i];
+    for (unsigned p = _tag_index.bucket[tag % CREDMAN_BUCKETS]; p; p = _tag_index.next[p - 1]) {
+        const credman_credential_t *c = &credentials[p - 1];
         if ((c->tag == tag) && (c->type == type)) {
-            return i;
+            return p - 1;
         }
-        /* only check until empty position found */
-        if ((empty) && (*empty == NULL) &&
-            (c->tag == CREDMAN_TAG_EMPTY) && (c->type == CREDMAN_TYPE_EMPTY)) {
-            *empty = c;
+    }
+    if (empty) {
+        for (unsigned i = 0; i < CONFIG_CREDMAN_MAX_CREDENTIALS; i++) {
+            credman_credential_t *c = &credentials[i];
+            if ((c->tag == CREDMAN_TAG_EMPTY) && (c->type == CREDMAN_TYPE_EMPTY)) {
+                *empty = c;
+                break;
+            }
         }
     }
     return -1;
@@ -430,6 +548,9 @@ void credman_reset(void)
     mutex_lock(&_mutex);
     memset(credentials, 0,
            sizeof(credman_credential_t) * CONFIG_CREDMAN_MAX_CREDENTIALS);
+    memset(&_tag_index, 0, sizeof(_tag_index));
+    memset(&_psk_id_index, 0, sizeof(_psk_id_index));
+    memset(&_psk_hint_index, 0, sizeof(_psk_hint_index));
     used = 0;
     mutex_unlock(&_mutex);
 }
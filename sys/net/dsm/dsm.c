@@ -18,6 +18,8 @@
  * @}
  */
 
+#include <inttypes.h>
+
 #include "net/dsm.h"
 #include "mutex.h"
 #include "net/sock/util.h"
@@ -39,6 +41,12 @@ static int _find_session(sock_dtls_t *sock, sock_dtls_session_t *to_find,
 static mutex_t _lock;
 static dsm_session_t _sessions[CONFIG_DSM_PEER_MAX];
 static uint8_t _available_slots;
+static dsm_stats_t _stats;
+
+static uint32_t _now_sec(void)
+{
+    return (uint32_t)(xtimer_now_usec64() / US_PER_SEC);
+}
 
 void dsm_init(void)
 {
@@ -63,6 +71,9 @@ dsm_state_t dsm_store(sock_dtls_t *sock, sock_dtls_session_t *session,
     prev_state = session_slot->state;
     if (session_slot->state != SESSION_STATE_ESTABLISHED) {
         session_slot->state = new_state;
+        if (new_state == SESSION_STATE_ESTABLISHED) {
+            _stats.handshakes++;
+        }
     }
 
     /* no existing session found */
@@ -79,7 +90,7 @@ dsm_state_t dsm_store(sock_dtls_t *sock, sock_dtls_session_t *session,
         DEBUG("dsm: existing session found, restoring\n");
         memcpy(session, &session_slot->session, sizeof(sock_dtls_session_t));
     }
-    session_slot->last_used_sec = (uint32_t)(xtimer_now_usec64() / US_PER_SEC);
+    session_slot->last_used_sec = _now_sec();
 
 out:
     mutex_unlock(&_lock);
@@ -151,6 +162,62 @@ ssize_t dsm_get_least_recently_used_session(sock_dtls_t *sock, sock_dtls_session
     return res;
 }
 
+void dsm_refresh(sock_dtls_t *sock, sock_dtls_session_t *session)
+{
+    dsm_session_t *session_slot = NULL;
+    mutex_lock(&_lock);
+    if (_find_session(sock, session, &session_slot) == 1) {
+        session_slot->last_used_sec = _now_sec();
+    }
+    mutex_unlock(&_lock);
+}
+
+ssize_t dsm_evict_idle_session(sock_dtls_t *sock, sock_dtls_session_t *session,
+                               uint32_t min_idle_sec)
+{
+    int res = -1;
+    dsm_session_t *session_slot = NULL;
+    mutex_lock(&_lock);
+    uint32_t now = _now_sec();
+    for (uint8_t i = 0; i < CONFIG_DSM_PEER_MAX; i++) {
+        if ((_sessions[i].state != SESSION_STATE_ESTABLISHED) ||
+            (_sessions[i].sock != sock) ||
+            (now - _sessions[i].last_used_sec < min_idle_sec)) {
+            continue;
+        }
+        if (session_slot == NULL ||
+            session_slot->last_used_sec > _sessions[i].last_used_sec) {
+            session_slot = &_sessions[i];
+        }
+    }
+
+    if (session_slot) {
+        memcpy(session, &session_slot->session, sizeof(sock_dtls_session_t));
+        session_slot->state = SESSION_STATE_NONE;
+        _available_slots++;
+        _stats.evicted++;
+        DEBUG("dsm: evicted session idle for %" PRIu32 " s\n",
+              now - session_slot->last_used_sec);
+        res = 1;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+void dsm_count_restored(void)
+{
+    mutex_lock(&_lock);
+    _stats.restored++;
+    mutex_unlock(&_lock);
+}
+
+void dsm_get_stats(dsm_stats_t *stats)
+{
+    mutex_lock(&_lock);
+    *stats = _stats;
+    mutex_unlock(&_lock);
+}
+
 /* Search for existing session or empty slot for new one
  * Returns 1, if existing session found
  * Returns 0, if empty slot found
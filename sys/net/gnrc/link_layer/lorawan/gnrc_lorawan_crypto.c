@@ -17,6 +17,7 @@
 #include <string.h>
 
 #include "hashes/aes128_cmac.h"
+#include "crypto/aes.h"
 #include "crypto/ciphers.h"
 
 #include "net/gnrc/lorawan.h"
@@ -45,6 +46,41 @@ static aes128_cmac_context_t CmacContext;
 static uint8_t digest[LORAMAC_APPKEY_LEN];
 static cipher_t AesContext;
 
+typedef struct {
+    uint8_t raw[LORAMAC_APPSKEY_LEN];   /**< key the entry was prepared for */
+    aes128_cmac_key_t key;              /**< key schedule and CMAC subkeys */
+} key_cache_t;
+
+static key_cache_t _key_cache[CONFIG_GNRC_LORAWAN_CRYPTO_CACHE_SIZE];
+static uint8_t _key_cache_used;
+static uint8_t _key_cache_next;
+
+/* Session keys are only changed by a join or by the user, but they are
+ * used for every frame. Looking them up by value keeps the cache valid no
+ * matter how they were changed. */
+static const aes128_cmac_key_t *_get_session_key(const uint8_t *raw)
+{
+    key_cache_t *entry;
+
+    for (unsigned i = 0; i < _key_cache_used; i++) {
+        if (memcmp(_key_cache[i].raw, raw, LORAMAC_APPSKEY_LEN) == 0) {
+            return &_key_cache[i].key;
+        }
+    }
+
+    entry = &_key_cache[_key_cache_next];
+    _key_cache_next = (_key_cache_next + 1) % CONFIG_GNRC_LORAWAN_CRYPTO_CACHE_SIZE;
+    if (_key_cache_used < CONFIG_GNRC_LORAWAN_CRYPTO_CACHE_SIZE) {
+        _key_cache_used++;
+    }
+
+    DEBUG("gnrc_lorawan_crypto: preparing session key\n");
+    memcpy(entry->raw, raw, LORAMAC_APPSKEY_LEN);
+    aes128_cmac_key_init(&entry->key, raw, LORAMAC_APPSKEY_LEN);
+
+    return &entry->key;
+}
+
 typedef struct __attribute__((packed)) {
     uint8_t fb;
     union {
@@ -126,7 +162,7 @@ void gnrc_lorawan_calculate_mic_uplink(iolist_t *frame, uint16_t conf_fcnt,
     block0.len = iolist_size(frame);
 
     /* cmacF = aes128_cmac(FNwkSIntKey, B0 | msg) */
-    aes128_cmac_init(&CmacContext, mac->ctx.fnwksintkey, LORAMAC_FNWKSINTKEY_LEN);
+    aes128_cmac_init_key(&CmacContext, _get_session_key(mac->ctx.fnwksintkey));
     aes128_cmac_update(&CmacContext, &block0, sizeof(block0));
     for (iolist_t *io = frame; io != NULL; io = io->iol_next) {
         aes128_cmac_update(&CmacContext, io->iol_base, io->iol_len);
@@ -157,7 +193,7 @@ void gnrc_lorawan_calculate_mic_uplink(iolist_t *frame, uint16_t conf_fcnt,
         block1.len = iolist_size(frame);
 
         /* cmacS = aes128_cmac(SNwkSIntKey, B1 | msg) */
-        aes128_cmac_init(&CmacContext, mac->ctx.snwksintkey, LORAMAC_SNWKSINTKEY_LEN);
+        aes128_cmac_init_key(&CmacContext, _get_session_key(mac->ctx.snwksintkey));
         aes128_cmac_update(&CmacContext, &block1, sizeof(block1));
         for (iolist_t *io = frame; io != NULL; io = io->iol_next) {
             aes128_cmac_update(&CmacContext, io->iol_base, io->iol_len);
@@ -186,7 +222,7 @@ void gnrc_lorawan_calculate_mic_downlink(const le_uint32_t *dev_addr,
     block.fcnt = byteorder_htoll(fcnt);
     block.len = iolist_size(frame);
 
-    aes128_cmac_init(&CmacContext, snwksintkey, LORAMAC_SNWKSINTKEY_LEN);
+    aes128_cmac_init_key(&CmacContext, _get_session_key(snwksintkey));
     aes128_cmac_update(&CmacContext, &block, sizeof(block));
     for (iolist_t *io = frame; io != NULL; io = io->iol_next) {
         aes128_cmac_update(&CmacContext, io->iol_base, io->iol_len);
@@ -205,8 +241,7 @@ void gnrc_lorawan_encrypt_fopts(uint8_t *fopts, size_t len,
     uint8_t a_block[16] = { 0 };
 
     lorawan_block0_t *block = (lorawan_block0_t *)a_block;
-
-    cipher_init(&AesContext, CIPHER_AES, key, LORAMAC_APPKEY_LEN);
+    const aes_key_t *aes = &_get_session_key(key)->aes;
 
     block->fb = CRYPT_B0_START;
 
@@ -223,7 +258,7 @@ void gnrc_lorawan_encrypt_fopts(uint8_t *fopts, size_t len,
 
     block->len = 0x01;
 
-    cipher_encrypt(&AesContext, a_block, s_block);
+    aes_encrypt_key_schedule(aes, a_block, s_block);
 
     for (size_t i = 0; i < len; i++) {
         fopts[i] ^= s_block[i];
@@ -242,8 +277,7 @@ void gnrc_lorawan_encrypt_payload(iolist_t *iolist, const le_uint32_t *dev_addr,
     memset(a_block, 0, sizeof(a_block));
 
     lorawan_block0_t *block = (lorawan_block0_t *)a_block;
-
-    cipher_init(&AesContext, CIPHER_AES, appskey, LORAMAC_APPKEY_LEN);
+    const aes_key_t *aes = &_get_session_key(appskey)->aes;
 
     block->fb = CRYPT_B0_START;
 
@@ -263,7 +297,7 @@ void gnrc_lorawan_encrypt_payload(iolist_t *iolist, const le_uint32_t *dev_addr,
 
             if ((c & SBIT_MASK) == 0) {
                 block->len = (c >> 4) + 1;
-                cipher_encrypt(&AesContext, a_block, s_block);
+                aes_encrypt_key_schedule(aes, a_block, s_block);
             }
 
             v[i] = v[i] ^ s_block[c & SBIT_MASK];
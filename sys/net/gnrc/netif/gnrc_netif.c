@@ -37,8 +37,10 @@
 #include "net/netstats.h"
 #include "net/netstats/neighbor.h"
 #include "fmt.h"
+#include "irq.h"
 #include "log.h"
 #include "sched.h"
+#include "trace.h"
 #if IS_USED(MODULE_ZTIMER)
 #include "ztimer.h"
 #endif
@@ -503,6 +505,31 @@ void gnrc_netif_release(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_IPV6)
 static int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
 static int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+/*
+ * The addresses and groups of all interfaces are kept in a hash table with
+ * linear probing. An entry refers to the address in the interface, so a
+ * lookup compares at most the addresses with the same 16-bit hash.
+ * Lookups may happen without holding the lock of any interface, so the table
+ * is only modified with interrupts disabled and _hash_seq is incremented with
+ * every modification. A lookup that got interrupted by one is repeated.
+ */
+typedef struct {
+    gnrc_netif_t *netif;    /**< interface of the address, NULL if unused */
+    uint16_t hash;          /**< hash of the address */
+    uint8_t idx;            /**< index in netif->ipv6.addrs or groups */
+    bool mcast;             /**< address is in netif->ipv6.groups */
+} _hash_entry_t;
+
+static _hash_entry_t _hash[CONFIG_GNRC_NETIF_IPV6_HASH_SIZE];
+static volatile unsigned _hash_seq;
+/* an address did not fit, so the table can not be used for lookups */
+static bool _hash_full;
+
+static void _hash_add(gnrc_netif_t *netif, unsigned idx, bool mcast);
+static void _hash_remove(const gnrc_netif_t *netif, unsigned idx, bool mcast);
+static gnrc_netif_t *_hash_get_netif(const ipv6_addr_t *addr);
+#endif
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -649,6 +676,9 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+    _hash_add(netif, idx, false);
+#endif
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -695,6 +725,9 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
     gnrc_netif_acquire(netif);
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
         if (ipv6_addr_equal(&netif->ipv6.addrs[i], addr)) {
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+            _hash_remove(netif, i, false);
+#endif
             netif->ipv6.addrs_flags[i] = 0;
             ipv6_addr_set_unspecified(&netif->ipv6.addrs[i]);
         }
@@ -771,6 +804,11 @@ gnrc_netif_t *gnrc_netif_get_by_ipv6_addr(const ipv6_addr_t *addr)
 
     DEBUG("gnrc_netif: get interface by IPv6 address %s\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+    if (!_hash_full) {
+        return ipv6_addr_is_unspecified(addr) ? NULL : _hash_get_netif(addr);
+    }
+#endif
     while ((netif = gnrc_netif_iter(netif))) {
         if (_addr_idx(netif, addr) >= 0) {
             break;
@@ -852,6 +890,9 @@ int gnrc_netif_ipv6_group_join_internal(gnrc_netif_t *netif,
         return -ENOMEM;
     }
     memcpy(&netif->ipv6.groups[idx], addr, sizeof(netif->ipv6.groups[idx]));
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+    _hash_add(netif, idx, true);
+#endif
     /* TODO:
      *  - MLD action
      */
@@ -913,6 +954,9 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
         }
     }
     if (idx >= 0) {
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+        _hash_remove(netif, idx, true);
+#endif
         ipv6_addr_set_unspecified(&netif->ipv6.groups[idx]);
         /* TODO:
          *  - MLD action */
@@ -931,9 +975,212 @@ int gnrc_netif_ipv6_group_idx(gnrc_netif_t *netif, const ipv6_addr_t *addr)
     return idx;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+static uint16_t _hash_of(const ipv6_addr_t *addr)
+{
+    uint32_t hash = 0;
+
+    /* mix in one word after the other, so that differences in prefix and
+     * interface identifier can not cancel each other out */
+    for (unsigned i = 0; i < ARRAY_SIZE(addr->u32); i++) {
+        hash = (hash ^ addr->u32[i].u32) * 2654435761U;
+        hash ^= hash >> 15;
+    }
+    return hash >> 16;
+}
+
+static inline unsigned _hash_next(unsigned i)
+{
+    return (i + 1 < CONFIG_GNRC_NETIF_IPV6_HASH_SIZE) ? i + 1 : 0;
+}
+
+static const ipv6_addr_t *_hash_entry_addr(const _hash_entry_t *entry)
+{
+    return (entry->mcast) ? &entry->netif->ipv6.groups[entry->idx]
+                          : &entry->netif->ipv6.addrs[entry->idx];
+}
+
+static bool _hash_insert(gnrc_netif_t *netif, unsigned idx, bool mcast,
+                         uint16_t hash)
+{
+    unsigned i = hash % CONFIG_GNRC_NETIF_IPV6_HASH_SIZE;
+
+    for (unsigned n = 0; n < CONFIG_GNRC_NETIF_IPV6_HASH_SIZE; n++) {
+        if (_hash[i].netif == NULL) {
+            _hash[i].netif = netif;
+            _hash[i].hash = hash;
+            _hash[i].idx = idx;
+            _hash[i].mcast = mcast;
+            return true;
+        }
+        i = _hash_next(i);
+    }
+    return false;
+}
+
+static void _hash_rebuild(const gnrc_netif_t *skip_netif, unsigned skip_idx,
+                          bool skip_mcast)
+{
+    gnrc_netif_t *netif = NULL;
+
+    memset(_hash, 0, sizeof(_hash));
+    _hash_full = false;
+    while (!_hash_full && (netif = gnrc_netif_iter(netif))) {
+        for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
+            if (((netif != skip_netif) || (i != skip_idx) || skip_mcast) &&
+                !ipv6_addr_is_unspecified(&netif->ipv6.addrs[i]) &&
+                !_hash_insert(netif, i, false, _hash_of(&netif->ipv6.addrs[i]))) {
+                _hash_full = true;
+            }
+        }
+        for (unsigned i = 0; i < GNRC_NETIF_IPV6_GROUPS_NUMOF; i++) {
+            if (((netif != skip_netif) || (i != skip_idx) || !skip_mcast) &&
+                !ipv6_addr_is_unspecified(&netif->ipv6.groups[i]) &&
+                !_hash_insert(netif, i, true, _hash_of(&netif->ipv6.groups[i]))) {
+                _hash_full = true;
+            }
+        }
+    }
+}
+
+static void _hash_add(gnrc_netif_t *netif, unsigned idx, bool mcast)
+{
+    const ipv6_addr_t *addr = (mcast) ? &netif->ipv6.groups[idx]
+                                      : &netif->ipv6.addrs[idx];
+    uint16_t hash = _hash_of(addr);
+    unsigned state = irq_disable();
+
+    if (!_hash_full && !_hash_insert(netif, idx, mcast, hash)) {
+        DEBUG("gnrc_netif: IPv6 address hash table exhausted\n");
+        _hash_full = true;
+    }
+    _hash_seq++;
+    irq_restore(state);
+}
+
+static void _hash_remove(const gnrc_netif_t *netif, unsigned idx, bool mcast)
+{
+    unsigned state = irq_disable();
+
+    _hash_seq++;
+    if (_hash_full) {
+        /* the address to be removed may make room for one that was left out,
+         * so just start over without it */
+        _hash_rebuild(netif, idx, mcast);
+        irq_restore(state);
+        return;
+    }
+
+    unsigned i = _hash_of((mcast) ? &netif->ipv6.groups[idx]
+                                  : &netif->ipv6.addrs[idx]) %
+                 CONFIG_GNRC_NETIF_IPV6_HASH_SIZE;
+    unsigned n;
+
+    for (n = 0; (n < CONFIG_GNRC_NETIF_IPV6_HASH_SIZE) &&
+                (_hash[i].netif != NULL); n++) {
+        if ((_hash[i].netif == netif) && (_hash[i].idx == idx) &&
+            (_hash[i].mcast == mcast)) {
+            break;
+        }
+        i = _hash_next(i);
+    }
+    if ((n == CONFIG_GNRC_NETIF_IPV6_HASH_SIZE) || (_hash[i].netif == NULL)) {
+        irq_restore(state);
+        return;
+    }
+    /* move later entries of the same probe sequence into the gap */
+    unsigned j = _hash_next(i);
+    for (n = 1; (n < CONFIG_GNRC_NETIF_IPV6_HASH_SIZE) &&
+                (_hash[j].netif != NULL); n++) {
+        unsigned home = _hash[j].hash % CONFIG_GNRC_NETIF_IPV6_HASH_SIZE;
+
+        /* entry j may only move to i if i lies within [home, j) */
+        if ((i < j) ? ((home <= i) || (home > j)) : ((home <= i) && (home > j))) {
+            _hash[i] = _hash[j];
+            i = j;
+        }
+        j = _hash_next(j);
+    }
+    _hash[i].netif = NULL;
+    irq_restore(state);
+}
+
+static int _hash_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr,
+                     bool mcast)
+{
+    uint16_t hash = _hash_of(addr);
+    unsigned seq;
+    int idx;
+
+    do {
+        unsigned i = hash % CONFIG_GNRC_NETIF_IPV6_HASH_SIZE;
+
+        seq = _hash_seq;
+        idx = -1;
+        for (unsigned n = 0; (n < CONFIG_GNRC_NETIF_IPV6_HASH_SIZE) &&
+                             (_hash[i].netif != NULL); n++) {
+            if ((_hash[i].hash == hash) && (_hash[i].netif == netif) &&
+                (_hash[i].mcast == mcast) &&
+                ipv6_addr_equal(_hash_entry_addr(&_hash[i]), addr)) {
+                idx = _hash[i].idx;
+                break;
+            }
+            i = _hash_next(i);
+        }
+    } while (seq != _hash_seq);
+    return idx;
+}
+
+static gnrc_netif_t *_hash_get_netif(const ipv6_addr_t *addr)
+{
+    uint16_t hash = _hash_of(addr);
+    gnrc_netif_t *netif;
+    bool multiple;
+    unsigned seq;
+
+    do {
+        unsigned i = hash % CONFIG_GNRC_NETIF_IPV6_HASH_SIZE;
+
+        seq = _hash_seq;
+        netif = NULL;
+        multiple = false;
+        for (unsigned n = 0; (n < CONFIG_GNRC_NETIF_IPV6_HASH_SIZE) &&
+                             (_hash[i].netif != NULL); n++) {
+            if ((_hash[i].hash == hash) && (_hash[i].netif != netif) &&
+                ipv6_addr_equal(_hash_entry_addr(&_hash[i]), addr)) {
+                multiple = (netif != NULL);
+                netif = _hash[i].netif;
+                if (multiple) {
+                    break;
+                }
+            }
+            i = _hash_next(i);
+        }
+    } while (seq != _hash_seq);
+
+    if (multiple) {
+        /* e.g. a multicast group joined on several interfaces: return the
+         * first of them, as without the hash table */
+        netif = NULL;
+        while ((netif = gnrc_netif_iter(netif))) {
+            if ((_hash_idx(netif, addr, false) >= 0) ||
+                (_hash_idx(netif, addr, true) >= 0)) {
+                break;
+            }
+        }
+    }
+    return netif;
+}
+#endif /* MODULE_GNRC_NETIF_IPV6_HASH */
+
 static int _idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr, bool mcast)
 {
     if (!ipv6_addr_is_unspecified(addr)) {
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+        if (!_hash_full) {
+            return _hash_idx(netif, addr, mcast);
+        }
+#endif
         const ipv6_addr_t *iplist = (mcast) ? netif->ipv6.groups :
                                               netif->ipv6.addrs;
         unsigned ipmax = (mcast) ? GNRC_NETIF_IPV6_GROUPS_NUMOF :
@@ -973,6 +1220,14 @@ static int _match_to_idx(const gnrc_netif_t *netif,
 
     int idx = -1;
     unsigned best_match = 0;
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_HASH)
+    /* nothing matches better than the address itself */
+    if (!_hash_full && ((idx = _hash_idx(netif, addr, false)) >= 0) &&
+        (netif->ipv6.addrs_flags[idx] != 0)) {
+        return idx;
+    }
+    idx = -1;
+#endif
     for (int i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
         unsigned match;
 
@@ -1926,6 +2181,10 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     /* Split off the TX sync snip */
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
+    if (IS_USED(MODULE_TRACE_NETIF)) {
+        trace_event(TRACE_EV_NETIF_SEND, ((uint32_t)netif->pid << 16) |
+                    (gnrc_pkt_len(pkt) & 0xffff));
+    }
     int res = netif->ops->send(netif, pkt);
 
     /* For legacy netdevs (no confirm_send) TX is blocking, thus it is always
@@ -2114,6 +2373,11 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
+                    if (IS_USED(MODULE_TRACE_NETIF)) {
+                        trace_event(TRACE_EV_NETIF_RECV,
+                                    ((uint32_t)netif->pid << 16) |
+                                    (gnrc_pkt_len(pkt) & 0xffff));
+                    }
                     _process_receive_stats(netif, pkt);
                     _pass_on_packet(pkt);
                 }
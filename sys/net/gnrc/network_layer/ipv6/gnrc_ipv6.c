@@ -16,6 +16,7 @@
 #include <inttypes.h>
 #include <kernel_defines.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "byteorder.h"
 #include "cpu_conf.h"
@@ -64,6 +65,24 @@ static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 fib_table_t gnrc_ipv6_fib_table;
 #endif
 
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+/**
+ * @brief   Next hop of a destination packets were recently forwarded to
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination address */
+    gnrc_netif_t *netif;        /**< interface to the next hop, NULL if unused */
+    uint32_t nib_gen;           /**< NIB generation the next hop is valid for */
+    uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];    /**< next hop */
+    uint8_t l2addr_len;         /**< length of _route_cache_entry_t::l2addr */
+} _route_cache_entry_t;
+
+/**
+ * @brief   The route cache, only accessed by the IPv6 thread
+ */
+static _route_cache_entry_t _route_cache[CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE];
+#endif
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
@@ -490,11 +509,81 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+static _route_cache_entry_t *_route_cache_entry(const ipv6_addr_t *dst)
+{
+    /* destinations behind the same router mostly differ in their interface
+     * identifier */
+    uint32_t hash = (dst->u32[2].u32 ^ dst->u32[3].u32) * 2654435761U;
+
+    return &_route_cache[(hash >> 16) % CONFIG_GNRC_IPV6_ROUTE_CACHE_SIZE];
+}
+
+static void _route_cache_add(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                             const gnrc_ipv6_nib_nc_t *nce, uint32_t nib_gen)
+{
+    _route_cache_entry_t *entry = _route_cache_entry(dst);
+
+    DEBUG("ipv6: cache next hop to %s\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    memcpy(entry->l2addr, nce->l2addr, nce->l2addr_len);
+    entry->l2addr_len = nce->l2addr_len;
+    entry->nib_gen = nib_gen;
+    entry->netif = netif;
+}
+
+/* Forwards a packet in receive order to the cached next hop of its
+ * destination. The interface header it was received with is rewritten for
+ * the next hop, so neither the NIB nor the packet buffer's allocator is
+ * involved. Returns false, if the packet has to take the usual path. */
+static bool _forward_cached(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *netif_hdr,
+                            const ipv6_hdr_t *hdr)
+{
+    _route_cache_entry_t *entry = _route_cache_entry(&hdr->dst);
+    gnrc_netif_hdr_t *netif_hdr_data;
+
+    if ((entry->netif == NULL) ||
+        (entry->nib_gen != gnrc_ipv6_nib_generation()) ||
+        !ipv6_addr_equal(&entry->dst, &hdr->dst) ||
+        (netif_hdr == NULL) || (netif_hdr->users > 1) ||
+        (gnrc_pktbuf_realloc_data(netif_hdr, sizeof(gnrc_netif_hdr_t) +
+                                             entry->l2addr_len) != 0)) {
+        return false;
+    }
+    DEBUG("ipv6: forward packet to cached next hop\n");
+    netif_hdr_data = netif_hdr->data;
+    gnrc_netif_hdr_init(netif_hdr_data, 0, entry->l2addr_len);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr_data, entry->l2addr,
+                                entry->l2addr_len);
+    if ((pkt = gnrc_pktbuf_reverse_snips(pkt)) == NULL) {
+        DEBUG("ipv6: unable to reverse pkt from receive order to send "
+              "order; dropping it\n");
+        return true;
+    }
+#ifdef MODULE_NETSTATS_IPV6
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    entry->netif->ipv6.stats.tx_unicast_count++;
+    irq_restore(irq_state);
+#endif
+    _send_to_iface(entry->netif, pkt);
+    return true;
+}
+#endif  /* MODULE_GNRC_IPV6_ROUTE_CACHE */
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
 {
     gnrc_ipv6_nib_nc_t nce;
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+    /* the lookup may change the NIB, so take the generation before it */
+    uint32_t nib_gen = gnrc_ipv6_nib_generation();
+    /* only cache next hops of forwarded packets, without preset interface */
+    bool cache = !prep_hdr && (netif == NULL) && (netif_hdr_flags == 0);
+#endif
 
     DEBUG("ipv6: send unicast\n");
     if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
@@ -506,6 +595,11 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+    if (cache) {
+        _route_cache_add(&ipv6_hdr->dst, netif, &nce, nib_gen);
+    }
+#endif
     if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
@@ -895,6 +989,11 @@ static void _receive(gnrc_pktsnip_t *pkt)
         else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
             DEBUG("ipv6: forward packet to next hop\n");
 
+#if IS_USED(MODULE_GNRC_IPV6_ROUTE_CACHE)
+            if (_forward_cached(pkt, netif_hdr, hdr)) {
+                return;
+            }
+#endif
             /* remove L2 headers around IPV6 */
             if (netif_hdr != NULL) {
                 gnrc_pktbuf_remove_snip(pkt, netif_hdr);
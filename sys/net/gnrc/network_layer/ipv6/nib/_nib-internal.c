@@ -46,6 +46,7 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
+static volatile uint32_t _nib_gen;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -78,9 +79,21 @@ void _nib_acquire(void)
 
 void _nib_release(void)
 {
+    /* whoever held the NIB may have changed it */
+    _nib_gen++;
     rmutex_unlock(&_nib_mutex);
 }
 
+void _nib_release_unchanged(void)
+{
+    rmutex_unlock(&_nib_mutex);
+}
+
+uint32_t gnrc_ipv6_nib_generation(void)
+{
+    return _nib_gen;
+}
+
 static inline bool _addr_equals(const ipv6_addr_t *addr,
                                 const _nib_onl_entry_t *node)
 {
@@ -897,19 +910,28 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
     }
 }
 
+typedef struct {
+    const void *ctx;
+    uint16_t type;
+} _evtimer_lookup_t;
+
+static bool _evtimer_match(const evtimer_event_t *event, const void *arg)
+{
+    const evtimer_msg_event_t *msg_event = (const evtimer_msg_event_t *)event;
+    const _evtimer_lookup_t *lookup = arg;
+
+    return (msg_event->msg.type == lookup->type) &&
+           ((lookup->ctx == NULL) || (msg_event->msg.content.ptr == lookup->ctx));
+}
+
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
-    evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
-    uint32_t offset = 0;
+    const _evtimer_lookup_t lookup = { .ctx = ctx, .type = type };
+    uint32_t offset;
 
     DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
-    while (event != NULL) {
-        offset += event->event.offset;
-        if ((event->msg.type == type) &&
-            ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
-            return offset;
-        }
-        event = (evtimer_msg_event_t *)event->event.next;
+    if (evtimer_find(&_nib_evtimer, _evtimer_match, &lookup, &offset)) {
+        return offset;
     }
     return UINT32_MAX;
 }
@@ -318,9 +318,19 @@ void _nib_acquire(void);
 
 /**
  * @brief   Release exclusive access to the NIB
+ *
+ * Changes the @ref gnrc_ipv6_nib_generation() "generation" of the NIB.
  */
 void _nib_release(void);
 
+/**
+ * @brief   Release exclusive access to the NIB without changing its
+ *          generation
+ *
+ * Only use this if the NIB was not changed since acquiring it.
+ */
+void _nib_release_unchanged(void);
+
 /**
  * @brief   Gets interface identifier from a NIB entry
  *
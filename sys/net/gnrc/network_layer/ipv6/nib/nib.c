@@ -120,12 +120,10 @@ static inline bool _should_search_rtr(const gnrc_netif_t *netif)
 
 void gnrc_ipv6_nib_init(void)
 {
-    evtimer_event_t *tmp;
+    evtimer_event_t *ptr;
 
     _nib_acquire();
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
+    while ((ptr = evtimer_find(&_nib_evtimer, NULL, NULL, NULL))) {
         evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
     }
     _nib_init();
@@ -288,14 +286,40 @@ static gnrc_netif_t *_acquire_new_iface(unsigned iface)
 {
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(iface);
     /* release NIB, in case other thread calls a NIB function while we wait for
-     * the netif */
-    _nib_release();
+     * the netif (nothing was changed so far, other threads changing the NIB in
+     * the meantime change its generation themselves) */
+    _nib_release_unchanged();
     gnrc_netif_acquire(netif);
     /* re-acquire NIB */
     _nib_acquire();
     return netif;
 }
 
+/* checks if a successful next hop lookup left the NIB as it was, so its result
+ * stays valid as long as the generation of the NIB does not change */
+static bool _next_hop_unchanged(const gnrc_netif_t *netif,
+                                const gnrc_ipv6_nib_nc_t *nce)
+{
+    unsigned nud_state = gnrc_ipv6_nib_nc_get_nud_state(nce);
+
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)) {
+        /* the destination cache is updated by every lookup */
+        return false;
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    if ((netif == NULL) || (netif->ipv6.route_info_cb != NULL)) {
+        /* the routing protocol may be informed about every lookup */
+        return false;
+    }
+#else
+    (void)netif;
+#endif
+    /* sending to a stale neighbor starts neighbor unreachability detection */
+    return !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) ||
+           (nud_state == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) ||
+           (nud_state == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED);
+}
+
 int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce)
@@ -398,7 +422,12 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             }
         }
     } while (0);
-    _nib_release();
+    if ((res == 0) && _next_hop_unchanged(netif, nce)) {
+        _nib_release_unchanged();
+    }
+    else {
+        _nib_release();
+    }
     gnrc_netif_release(netif);
     return res;
 }
@@ -1709,15 +1709,7 @@ static void _sched_next_frame(gnrc_sixlowpan_frag_fb_t *fbuf)
 
 static inline bool _arq_scheduled(gnrc_sixlowpan_frag_fb_t *fbuf)
 {
-    evtimer_event_t *ptr = _arq_timer.events;
-    evtimer_event_t *event = &fbuf->sfr.arq_timeout_event.event;
-    while (ptr) {
-        if (ptr == event) {
-            return true;
-        }
-        ptr = ptr->next;
-    }
-    return false;
+    return evtimer_is_set(&_arq_timer, &fbuf->sfr.arq_timeout_event.event);
 }
 
 static void _sched_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf, uint32_t offset)
@@ -34,13 +34,21 @@
 #include "net/gnrc/rpl/p2p.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
 #endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
+#include "net/netstats/neighbor.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
-static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag);
+/* instance returned by the last successful gnrc_rpl_instance_get() */
+static gnrc_rpl_instance_t *_last_inst;
+
+static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag,
+                                                          gnrc_rpl_parent_t *old_best,
+                                                          gnrc_rpl_parent_t *parent);
 
 static void _rpl_trickle_send_dio(void *args)
 {
@@ -137,9 +145,14 @@ bool gnrc_rpl_instance_remove(gnrc_rpl_instance_t *inst)
 
 gnrc_rpl_instance_t *gnrc_rpl_instance_get(uint8_t instance_id)
 {
+    /* most nodes only ever see messages of a single instance */
+    if ((_last_inst != NULL) && (_last_inst->state != 0) && (_last_inst->id == instance_id)) {
+        return _last_inst;
+    }
     for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
         if ((gnrc_rpl_instances[i].state != 0) && (gnrc_rpl_instances[i].id == instance_id)) {
-            return &gnrc_rpl_instances[i];
+            _last_inst = &gnrc_rpl_instances[i];
+            return _last_inst;
         }
     }
     return NULL;
@@ -196,33 +209,120 @@ void gnrc_rpl_dodag_remove_all_parents(gnrc_rpl_dodag_t *dodag)
     dodag->my_rank = GNRC_RPL_INFINITE_RANK;
 }
 
+/**
+ * @brief   Move @p parent to its position in the parent list of @p dodag, which
+ *          is kept ordered by the objective function
+ *
+ * Only @p parent may be out of order, so this takes a single pass over the
+ * list and returns early if its position did not change.
+ *
+ * @param[in] dodag     Pointer to the DODAG
+ * @param[in] parent    Pointer to the parent whose rank or metric changed
+ */
+static void _parent_reorder(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
+{
+    int (*cmp)(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *) = dodag->instance->of->parent_cmp;
+    gnrc_rpl_parent_t *prev = NULL;
+    gnrc_rpl_parent_t *elt = dodag->parents;
+    gnrc_rpl_parent_t **pos;
+
+    while (elt != parent) {
+        if (elt == NULL) {
+            /* not part of this DODAG */
+            return;
+        }
+        prev = elt;
+        elt = elt->next;
+    }
+
+    if (((prev == NULL) || (cmp(prev, parent) <= 0)) &&
+        ((parent->next == NULL) || (cmp(parent, parent->next) <= 0))) {
+        return;
+    }
+
+    if (prev == NULL) {
+        dodag->parents = parent->next;
+    }
+    else {
+        prev->next = parent->next;
+    }
+
+    /* insert after all parents that are at least as good */
+    pos = &dodag->parents;
+    while ((*pos != NULL) && (cmp(*pos, parent) <= 0)) {
+        pos = &(*pos)->next;
+    }
+    parent->next = *pos;
+    *pos = parent;
+}
+
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
+/**
+ * @brief   Sample the ETX of the link to @p parent, as recorded by the
+ *          interface, into its link metric
+ *
+ * The objective function only compares the sampled value, so the order of
+ * the parent list does not change between updates of the parent.
+ *
+ * @param[in] parent    Pointer to the parent
+ */
+static void _parent_sample_etx(gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    uint8_t l2_addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    netstats_nb_t stats;
+    int len;
+
+    /* the initial ETX, if the parent is unknown */
+    parent->link_metric = NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    parent->link_metric_type = GNRC_RPL_METRIC_ETX;
+    if ((netif == NULL) || !(netif->flags & GNRC_NETIF_FLAGS_HAS_L2ADDR)) {
+        return;
+    }
+    len = gnrc_netif_ipv6_iid_to_addr(netif, (eui64_t *)&parent->addr.u64[1],
+                                      l2_addr);
+    if ((len > 0) && netstats_nb_get(&netif->netif, l2_addr, len, &stats)) {
+        parent->link_metric = stats.etx;
+    }
+}
+#endif
+
 bool gnrc_rpl_parent_add_by_addr(gnrc_rpl_dodag_t *dodag, ipv6_addr_t *addr,
                                  gnrc_rpl_parent_t **parent)
 {
+    gnrc_rpl_parent_t *elt;
+
+    /* all parents of the DODAG are in its parent list */
+    LL_FOREACH(dodag->parents, elt) {
+        if (ipv6_addr_equal(&elt->addr, addr)) {
+            DEBUG("parent (%s) exists\n", ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
+            *parent = elt;
+            return false;
+        }
+    }
+
     *parent = NULL;
-    bool first = true;
     for (uint8_t i = 0; i < GNRC_RPL_PARENTS_NUMOF; ++i) {
-        /* save position to the first unused parent */
-        if ((gnrc_rpl_parents[i].state == 0) && first) {
-            *parent = &gnrc_rpl_parents[i];
-            first = false;
-            continue;
-        }
-        /* return false if parent exists */
-        else if ((gnrc_rpl_parents[i].state != 0) && (gnrc_rpl_parents[i].dodag == dodag) &&
-                 ipv6_addr_equal(&gnrc_rpl_parents[i].addr, addr)) {
-            DEBUG("parent (%s) exists\n", ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
+        if (gnrc_rpl_parents[i].state == 0) {
             *parent = &gnrc_rpl_parents[i];
-            return false;
+            break;
         }
     }
 
     if (*parent != NULL) {
         (*parent)->dodag = dodag;
-        LL_APPEND(dodag->parents, *parent);
         (*parent)->state = GNRC_RPL_PARENT_ACTIVE;
         (*parent)->addr = *addr;
         (*parent)->rank = GNRC_RPL_INFINITE_RANK;
+        /* appending keeps the list ordered, a parent with infinite rank is
+         * never better than any other */
+        LL_APPEND(dodag->parents, *parent);
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
+        /* unless its link is better than the one of another parent with
+         * infinite rank */
+        _parent_sample_etx(*parent);
+        _parent_reorder(dodag, *parent);
+#endif
         evtimer_del((evtimer_t *)(&gnrc_rpl_evtimer), (evtimer_event_t *)(&(*parent)->timeout_event));
         ((evtimer_event_t *)(&(*parent)->timeout_event))->next = NULL;
         (*parent)->timeout_event.msg.type = GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT;
@@ -285,6 +385,8 @@ void gnrc_rpl_local_repair(gnrc_rpl_dodag_t *dodag)
 
 void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 {
+    gnrc_rpl_parent_t *old_best = dodag->parents;
+
     /* update Parent lifetime */
     if ((parent != NULL) && (parent->state != GNRC_RPL_PARENT_UNUSED)) {
         parent->state = GNRC_RPL_PARENT_ACTIVE;
@@ -303,24 +405,37 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 #ifdef MODULE_GNRC_RPL_P2P
         }
 #endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
+        _parent_sample_etx(parent);
+#endif
+        _parent_reorder(dodag, parent);
+    }
+    else {
+        parent = NULL;
     }
 
-    if (_gnrc_rpl_find_preferred_parent(dodag) == NULL) {
+    if (_gnrc_rpl_find_preferred_parent(dodag, old_best, parent) == NULL) {
         gnrc_rpl_local_repair(dodag);
     }
 }
 
 /**
- * @brief   Find the parent with the lowest rank and update the DODAG's preferred parent
+ * @brief   Update the DODAG's preferred parent and rank after a parent changed
+ *
+ * The parent list is kept ordered by the objective function, so the
+ * preferred parent is the head of the list.
  *
  * @param[in] dodag     Pointer to the DODAG
+ * @param[in] old_best  Preferred parent before the change
+ * @param[in] parent    The parent that changed, NULL if it was removed
  *
  * @return  Pointer to the preferred parent, on success.
  * @return  NULL, otherwise.
  */
-static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag)
+static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag,
+                                                          gnrc_rpl_parent_t *old_best,
+                                                          gnrc_rpl_parent_t *parent)
 {
-    gnrc_rpl_parent_t *old_best = dodag->parents;
     gnrc_rpl_parent_t *new_best;
     uint16_t old_rank = dodag->my_rank;
     gnrc_rpl_parent_t *elt = NULL;
@@ -330,7 +445,6 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
         return NULL;
     }
 
-    LL_SORT(dodag->parents, dodag->instance->of->parent_cmp);
     new_best = dodag->parents;
 
     if (new_best->rank == GNRC_RPL_INFINITE_RANK) {
@@ -362,6 +476,14 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
         trickle_reset_timer(&dodag->trickle);
         gnrc_rpl_rpble_update(dodag);
     }
+    else if (parent != NULL) {
+        /* all other parents were checked against the same rank before */
+        if (DAGRANK(dodag->my_rank, dodag->instance->min_hop_rank_inc)
+            <= DAGRANK(parent->rank, dodag->instance->min_hop_rank_inc)) {
+            gnrc_rpl_parent_remove(parent);
+        }
+        return dodag->parents;
+    }
 
     LL_FOREACH_SAFE(dodag->parents, elt, tmp) {
         if (DAGRANK(dodag->my_rank, dodag->instance->min_hop_rank_inc)
@@ -84,6 +84,17 @@ int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
     else if (parent1->rank > parent2->rank) {
         return 1;
     }
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
+    /* prefer the better link among parents of the same rank, the ETX is
+     * sampled when a parent is updated, so that the order of the parent
+     * list only changes then */
+    if (parent1->link_metric < parent2->link_metric) {
+        return -1;
+    }
+    else if (parent1->link_metric > parent2->link_metric) {
+        return 1;
+    }
+#endif
     return 0;
 }
 
@@ -197,32 +197,28 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+ssize_t gnrc_sock_peek_len(gnrc_sock_reg_t *reg)
 {
-    gnrc_pktsnip_t *pkt;
+    msg_t msg;
+
+    if (!mbox_peek(&reg->mbox, &msg) ||
+        (msg.type != GNRC_NETAPI_MSG_TYPE_RCV)) {
+        return -EAGAIN;
+    }
+    return ((gnrc_pktsnip_t *)msg.content.ptr)->size;
+}
+
+int gnrc_sock_hdr_build(gnrc_pktsnip_t **pkt_inout, const sock_ip_ep_t *local,
+                        const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt, *payload = *pkt_inout;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
-    gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
-#ifdef MODULE_GNRC_NETERR
-    unsigned status_subs = 0;
-#endif
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    gnrc_tx_sync_t tx_sync;
-#endif
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
         return -EAFNOSUPPORT;
     }
 
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
-        gnrc_pktbuf_release(payload);
-        return -ENOMEM;
-    }
-#endif
-
     switch (local->family) {
 #ifdef SOCK_HAS_IPV6
         case AF_INET6: {
@@ -230,14 +226,11 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
             pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
                                       (ipv6_addr_t *)&remote->addr.ipv6);
             if (pkt == NULL) {
+                gnrc_pktbuf_release(payload);
                 return -ENOMEM;
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
-                type = GNRC_NETTYPE_IPV6;
-            }
-            else {
-                type = payload->type;
             }
             hdr = pkt->data;
             hdr->nh = nh;
@@ -269,10 +262,42 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         netif_hdr->if_pid = iface;
         pkt = gnrc_pkt_prepend(pkt, netif);
     }
+    *pkt_inout = pkt;
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt = payload;
+    gnrc_nettype_t type;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int res;
+#ifdef MODULE_GNRC_NETERR
+    unsigned status_subs = 0;
+#endif
+#if IS_USED(MODULE_GNRC_TX_SYNC)
+    gnrc_tx_sync_t tx_sync;
+#endif
+
+    if (local->family != remote->family) {
+        gnrc_pktbuf_release(payload);
+        return -EAFNOSUPPORT;
+    }
+
+#if IS_USED(MODULE_GNRC_TX_SYNC)
+    if (gnrc_tx_sync_append(payload, &tx_sync)) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+#endif
+
+    if ((res = gnrc_sock_hdr_build(&pkt, local, remote, nh)) < 0) {
+        return res;
+    }
+    /* dispatch to the payload's protocol, IPv6 for raw payloads */
+    type = payload->type;
 #ifdef MODULE_GNRC_NETERR
-    /* cppcheck-suppress uninitvar
-     * (reason: pkt is initialized in AF_INET6 case above, otherwise function
-     * will return early) */
     for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
         /* no error should occur since pkt was created here */
         gnrc_neterr_reg(ptr);
@@ -158,6 +158,28 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux);
 
+/**
+ * @brief   Get the payload size of the next packet without taking it
+ *
+ * @return  size of the first snip of the next packet in the mbox of @p reg
+ * @return  -EAGAIN if there is no packet waiting
+ * @internal
+ */
+ssize_t gnrc_sock_peek_len(gnrc_sock_reg_t *reg);
+
+/**
+ * @brief   Prepend the network layer header (and netif header) to a payload
+ *
+ * @param[in,out] pkt   The payload on input, the packet on success. Released
+ *                      on error.
+ *
+ * @return  0 on success
+ * @return  -EAFNOSUPPORT or -ENOMEM on error
+ * @internal
+ */
+int gnrc_sock_hdr_build(gnrc_pktsnip_t **pkt, const sock_ip_ep_t *local,
+                        const sock_ip_ep_t *remote, uint8_t nh);
+
 /**
  * @brief   Send a packet internally
  * @internal
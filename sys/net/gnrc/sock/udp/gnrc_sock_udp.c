@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "byteorder.h"
+#include "container.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -37,6 +38,14 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief   Maximum number of datagrams sock_udp_send_many() hands to the UDP
+ *          thread at once
+ */
+#ifndef GNRC_SOCK_UDP_SEND_MANY_MAX
+#define GNRC_SOCK_UDP_SEND_MANY_MAX (8U)
+#endif
+
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
 static sock_udp_t *_udp_socks = NULL;
 #endif
@@ -330,17 +339,21 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/**
+ * @brief   Builds UDP header and payload of a datagram
+ *
+ * @param[out] pkt      The UDP packet
+ * @param[out] local    Local end point to send the packet from
+ * @param[out] rem      Remote end point to send the packet to
+ */
+static int _build(sock_udp_t *sock, const iolist_t *snips,
+                  const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                  gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                  sock_udp_ep_t *rem)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
+    gnrc_pktsnip_t *payload;
     uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -369,7 +382,7 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
+        memset(local, 0, sizeof(*local));
         if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
@@ -395,34 +408,34 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     }
     else {
         src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
         src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
+        memcpy(rem, &sock->remote, sizeof(*rem));
         dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
         dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
 
@@ -435,24 +448,158 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     /* copy payload data into payload snip */
     iolist_to_buffer(snips, payload->data, payload->size);
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
-    if (pkt == NULL) {
+    *pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    if (*pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
-    if (res > 0) {
-        res -= sizeof(udp_hdr_t);
-    }
+    return 0;
+}
+
+static void _sent(sock_udp_t *sock)
+{
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    gnrc_pktsnip_t *pkt;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+    ssize_t res;
+
+    res = _build(sock, snips, remote, aux, &pkt, &local, &rem);
+    if (res < 0) {
+        return res;
+    }
+    res = gnrc_sock_send(pkt, &local, (sock_ip_ep_t *)&rem, PROTNUM_UDP);
+    if (res > 0) {
+        res -= sizeof(udp_hdr_t);
+    }
+    _sent(sock);
     return res;
 }
 
+int sock_udp_send_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num)
+{
+    int res = 0;
+    unsigned i = 0;
+
+    assert((sock != NULL) && ((msgs != NULL) || (num == 0)));
+#if IS_USED(MODULE_GNRC_TX_SYNC) || defined(MODULE_GNRC_NETERR)
+    /* sending waits for the stack to handle every single datagram */
+    for (; i < num; i++) {
+        ssize_t sent = sock_udp_sendv_aux(sock, msgs[i].snips,
+                                          msgs[i].remote, NULL);
+        if (sent < 0) {
+            res = sent;
+            break;
+        }
+        msgs[i].len = sent;
+    }
+#else
+    while (i < num) {
+        gnrc_pktsnip_t *pkts[GNRC_SOCK_UDP_SEND_MANY_MAX];
+        unsigned n;
+
+        for (n = 0; (n < ARRAY_SIZE(pkts)) && ((i + n) < num); n++) {
+            sock_udp_msg_t *msg = &msgs[i + n];
+            sock_ip_ep_t local;
+            sock_udp_ep_t rem;
+
+            res = _build(sock, msg->snips, msg->remote, NULL, &pkts[n],
+                         &local, &rem);
+            if (res == 0) {
+                res = gnrc_sock_hdr_build(&pkts[n], &local,
+                                          (sock_ip_ep_t *)&rem, PROTNUM_UDP);
+            }
+            if (res < 0) {
+                break;
+            }
+            msg->len = iolist_size(msg->snips);
+        }
+        if (n > 0) {
+            /* one round trip to the UDP thread for all of them */
+            gnrc_udp_send_many(pkts, n);
+            for (unsigned j = 0; j < n; j++) {
+                _sent(sock);
+            }
+            i += n;
+        }
+        if ((res == -ENOMEM) && (n > 0)) {
+            /* the packet buffer may have room again for the rest */
+            res = 0;
+        }
+        else if (res < 0) {
+            break;
+        }
+    }
+#endif
+    return ((i == 0) && (res < 0)) ? res : (int)i;
+}
+
+static ssize_t _copy_to_snips(const iolist_t *snips, const void *data,
+                              size_t len)
+{
+    const uint8_t *src = data;
+
+    if (iolist_size(snips) < len) {
+        return -ENOBUFS;
+    }
+    for (size_t left = len; left > 0; snips = snips->iol_next) {
+        size_t chunk = (snips->iol_len < left) ? snips->iol_len : left;
+
+        memcpy(snips->iol_base, src, chunk);
+        src += chunk;
+        left -= chunk;
+    }
+    return len;
+}
+
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        void *data = NULL, *ctx = NULL;
+        ssize_t res;
+
+        if (i > 0) {
+            /* only take datagrams that are already waiting and leave one
+             * that does not fit to the next call */
+            res = gnrc_sock_peek_len(&sock->reg);
+            if ((res < 0) || ((size_t)res > iolist_size(msgs[i].snips))) {
+                break;
+            }
+        }
+        res = sock_udp_recv_buf_aux(sock, &data, &ctx, (i == 0) ? timeout : 0,
+                                    msgs[i].remote, NULL);
+        if (res >= 0) {
+            res = _copy_to_snips(msgs[i].snips, data, res);
+        }
+        if (ctx != NULL) {
+            /* release the packet */
+            sock_udp_recv_buf_aux(sock, &data, &ctx, 0, NULL, NULL);
+        }
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+        msgs[i].len = res;
+    }
+    return i;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
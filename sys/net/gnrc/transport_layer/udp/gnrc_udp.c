@@ -18,6 +18,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 
@@ -45,6 +46,11 @@ static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
 
+/**
+ * @brief   Registration of the UDP thread at netreg
+ */
+static gnrc_netreg_entry_t _netreg;
+
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
  *
@@ -221,15 +227,15 @@ static void *_event_loop(void *arg)
 {
     (void)arg;
     msg_t msg, reply;
-    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
-                                                            thread_getpid());
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
     /* initialize message queue */
     msg_init_queue(_msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
     /* register UPD at netreg */
-    gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
+    gnrc_netreg_entry_init_pid(&_netreg, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_netreg);
 
     /* dispatch NETAPI messages */
     while (1) {
@@ -243,6 +249,19 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
                 break;
+            case GNRC_UDP_MSG_TYPE_SND_MANY: {
+                gnrc_udp_batch_t *batch = msg.content.ptr;
+                msg_t ack = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+                DEBUG("udp: GNRC_UDP_MSG_TYPE_SND_MANY (%u packets)\n",
+                      batch->num);
+                for (unsigned i = 0; i < batch->num; i++) {
+                    _send(batch->pkts[i]);
+                }
+                /* the batch lives on the stack of the sender */
+                msg_reply(&msg, &ack);
+                break;
+            }
             case GNRC_NETAPI_MSG_TYPE_SET:
             case GNRC_NETAPI_MSG_TYPE_GET:
                 msg_reply(&msg, &reply);
@@ -297,6 +316,34 @@ gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
     return res;
 }
 
+void gnrc_udp_send_many(gnrc_pktsnip_t **pkts, unsigned num)
+{
+    bool batch;
+
+    /* packets of other subscribers must not be taken by the UDP thread */
+    gnrc_netreg_acquire_shared();
+    batch = (_pid != KERNEL_PID_UNDEF) && (thread_getpid() != _pid) &&
+            (gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                GNRC_NETREG_DEMUX_CTX_ALL) == &_netreg) &&
+            (gnrc_netreg_num(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL) == 1);
+    gnrc_netreg_release_shared();
+    if (batch && (num > 1)) {
+        gnrc_udp_batch_t pkts_batch = { .pkts = pkts, .num = num };
+        msg_t msg = { .type = GNRC_UDP_MSG_TYPE_SND_MANY,
+                      .content = { .ptr = &pkts_batch } };
+
+        msg_send_receive(&msg, &msg, _pid);
+        return;
+    }
+    for (unsigned i = 0; i < num; i++) {
+        if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                       GNRC_NETREG_DEMUX_CTX_ALL, pkts[i])) {
+            DEBUG("udp: cannot send packet: UDP not found\n");
+            gnrc_pktbuf_release(pkts[i]);
+        }
+    }
+}
+
 int gnrc_udp_init(void)
 {
     /* check if thread is already running */
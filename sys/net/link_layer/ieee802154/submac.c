@@ -67,6 +67,67 @@ static bool _has_retrans_left(ieee802154_submac_t *submac)
     return submac->retrans < CONFIG_IEEE802154_DEFAULT_MAX_FRAME_RETRANS;
 }
 
+static int _handle_fsm_ev_request_tx(ieee802154_submac_t *submac);
+
+static void _prepare_tx(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    uint8_t *buf = iolist->iol_base;
+
+    submac->wait_for_ack = buf[0] & IEEE802154_FCF_ACK_REQ;
+    submac->psdu = iolist;
+    submac->retrans = 0;
+    submac->csma_retries_nb = 0;
+    submac->backoff_mask = (1 << submac->be.min) - 1;
+}
+
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+static int _queue_frame(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    if (submac->next_len) {
+        return -EBUSY;
+    }
+
+    ssize_t len = iolist_to_buffer(iolist, submac->next_psdu, sizeof(submac->next_psdu));
+
+    if (len < 0) {
+        return -EOVERFLOW;
+    }
+    submac->next_len = len;
+    return 0;
+}
+
+static bool _start_queued(ieee802154_submac_t *submac)
+{
+    int res;
+
+    /* This is required to prevent unused variable warnings */
+    (void) res;
+
+    if (submac->next_len == 0) {
+        return false;
+    }
+
+    submac->next_iol.iol_next = NULL;
+    submac->next_iol.iol_base = submac->next_psdu;
+    submac->next_iol.iol_len = submac->next_len;
+    _prepare_tx(submac, &submac->next_iol);
+
+    /* the radio was just set to idle, so this can't fail */
+    res = _handle_fsm_ev_request_tx(submac);
+    assert(res >= 0);
+
+    /* the frame is in the framebuffer now, free the queue */
+    submac->next_len = 0;
+    return true;
+}
+#else
+static inline bool _start_queued(ieee802154_submac_t *submac)
+{
+    (void)submac;
+    return false;
+}
+#endif
+
 static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
                                       ieee802154_tx_info_t *info)
 {
@@ -80,8 +141,16 @@ static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
     res = ieee802154_radio_set_idle(&submac->dev, true);
 
     assert(res >= 0);
+
+    /* Start a queued frame before reporting, so that the upper layer can
+     * queue the one after it from the callback */
+    bool started = _start_queued(submac);
+
     submac->cb->tx_done(submac, status, info);
-    return IEEE802154_FSM_STATE_IDLE;
+    if (!started) {
+        started = _start_queued(submac);
+    }
+    return started ? IEEE802154_FSM_STATE_PREPARE : IEEE802154_FSM_STATE_IDLE;
 }
 
 static void _print_debug(ieee802154_fsm_state_t old, ieee802154_fsm_state_t new,
@@ -408,6 +477,11 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
     ieee802154_fsm_state_t current_state = submac->fsm_state;
 
     if (current_state != IEEE802154_FSM_STATE_RX && current_state != IEEE802154_FSM_STATE_IDLE) {
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+        if (iolist != NULL) {
+            return _queue_frame(submac, iolist);
+        }
+#endif
         return -EBUSY;
     }
 
@@ -415,14 +489,7 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
         return 0;
     }
 
-    uint8_t *buf = iolist->iol_base;
-    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
-
-    submac->wait_for_ack = cnf;
-    submac->psdu = iolist;
-    submac->retrans = 0;
-    submac->csma_retries_nb = 0;
-    submac->backoff_mask = (1 << submac->be.min) - 1;
+    _prepare_tx(submac, iolist);
 
     if (ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX)
         != IEEE802154_FSM_STATE_PREPARE) {
@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <errno.h>
 
 #include "net/l2util.h"
@@ -27,6 +28,9 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static_assert(NETSTATS_NB_SIZE < UINT8_MAX,
+              "the hash index only supports up to 254 neighbors");
+
 static inline void _lock(netif_t *dev)
 {
     mutex_lock(&dev->neighbors.lock);
@@ -101,18 +105,79 @@ bool netstats_nb_isfresh(netif_t *dev, netstats_nb_t *stats)
     return ret;
 }
 
+static unsigned _hash(const uint8_t *l2_addr, uint8_t len)
+{
+    unsigned hash = 0;
+
+    for (unsigned i = 0; i < len; i++) {
+        hash = hash * 31 + l2_addr[i];
+    }
+
+    return hash % NETSTATS_NB_HASH_SIZE;
+}
+
+static void _hash_insert(netstats_nb_table_t *tbl, unsigned idx)
+{
+    uint8_t *head = &tbl->hash_head[_hash(tbl->pstats[idx].l2_addr,
+                                          tbl->pstats[idx].l2_addr_len)];
+
+    tbl->hash_next[idx] = *head;
+    *head = idx + 1;
+}
+
+static void _hash_remove(netstats_nb_table_t *tbl, unsigned idx)
+{
+    uint8_t *link = &tbl->hash_head[_hash(tbl->pstats[idx].l2_addr,
+                                          tbl->pstats[idx].l2_addr_len)];
+
+    while (*link) {
+        if (*link == idx + 1) {
+            *link = tbl->hash_next[idx];
+            break;
+        }
+        link = &tbl->hash_next[*link - 1];
+    }
+    tbl->hash_next[idx] = 0;
+}
+
+static netstats_nb_t *_hash_find(netstats_nb_table_t *tbl,
+                                 const uint8_t *l2_addr, uint8_t len)
+{
+    unsigned idx = tbl->hash_head[_hash(l2_addr, len)];
+
+    while (idx) {
+        netstats_nb_t *entry = &tbl->pstats[idx - 1];
+
+        if (l2util_addr_equal(entry->l2_addr, entry->l2_addr_len, l2_addr, len)) {
+            return entry;
+        }
+        idx = tbl->hash_next[idx - 1];
+    }
+
+    return NULL;
+}
+
 void netstats_nb_init(netif_t *dev)
 {
     mutex_init(&dev->neighbors.lock);
 
     _lock(dev);
     memset(dev->neighbors.pstats, 0, sizeof(netstats_nb_t) * NETSTATS_NB_SIZE);
+    memset(dev->neighbors.hash_head, 0, sizeof(dev->neighbors.hash_head));
+    memset(dev->neighbors.hash_next, 0, sizeof(dev->neighbors.hash_next));
     cib_init(&dev->neighbors.stats_idx, NETSTATS_NB_QUEUE_SIZE);
     _unlock(dev);
 }
 
-static void netstats_nb_create(netstats_nb_t *entry, const uint8_t *l2_addr, uint8_t l2_len)
+static void netstats_nb_create(netstats_nb_table_t *tbl, netstats_nb_t *entry,
+                               const uint8_t *l2_addr, uint8_t l2_len)
 {
+    unsigned idx = entry - tbl->pstats;
+
+    if (entry->l2_addr_len) {
+        _hash_remove(tbl, idx);
+    }
+
     memset(entry, 0, sizeof(netstats_nb_t));
     memcpy(entry->l2_addr, l2_addr, l2_len);
     entry->l2_addr_len = l2_len;
@@ -120,42 +185,37 @@ static void netstats_nb_create(netstats_nb_t *entry, const uint8_t *l2_addr, uin
 #ifdef MODULE_NETSTATS_NEIGHBOR_ETX
     entry->etx = NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
 #endif
+
+    _hash_insert(tbl, idx);
 }
 
 bool netstats_nb_get(netif_t *dev, const uint8_t *l2_addr, uint8_t len, netstats_nb_t *out)
 {
     _lock(dev);
 
-    netstats_nb_t *stats = dev->neighbors.pstats;
-    bool found = false;
-
-    for (int i = 0; i < NETSTATS_NB_SIZE; i++) {
+    netstats_nb_t *stats = _hash_find(&dev->neighbors, l2_addr, len);
 
-        /* Check if this is the matching entry */
-        if (l2util_addr_equal(stats[i].l2_addr, stats[i].l2_addr_len, l2_addr, len)) {
-            *out = stats[i];
-            found = true;
-            break;
-        }
+    if (stats) {
+        *out = *stats;
     }
 
     _unlock(dev);
-    return found;
+    return stats != NULL;
 }
 
 /* find the oldest inactive entry to replace. Empty entries are infinity old */
 static netstats_nb_t *netstats_nb_get_or_create(netif_t *dev, const uint8_t *l2_addr, uint8_t len)
 {
-    netstats_nb_t *old_entry = NULL;
+    netstats_nb_t *old_entry = _hash_find(&dev->neighbors, l2_addr, len);
     netstats_nb_t *stats = dev->neighbors.pstats;
     uint16_t now = xtimer_now_usec() / US_PER_SEC;
 
-    for (int i = 0; i < NETSTATS_NB_SIZE; i++) {
+    if (old_entry) {
+        return old_entry;
+    }
 
-        /* Check if this is the matching entry */
-        if (l2util_addr_equal(stats[i].l2_addr, stats[i].l2_addr_len, l2_addr, len)) {
-            return &stats[i];
-        }
+    /* only a new neighbor needs to scan the table */
+    for (int i = 0; i < NETSTATS_NB_SIZE; i++) {
 
         /* Entry is oldest if it is empty */
         if (stats[i].l2_addr_len == 0) {
@@ -178,7 +238,7 @@ static netstats_nb_t *netstats_nb_get_or_create(netif_t *dev, const uint8_t *l2_
     /* if there is no matching entry,
      * create a new entry if we have an expired one */
     if (old_entry) {
-        netstats_nb_create(old_entry, l2_addr, len);
+        netstats_nb_create(&dev->neighbors, old_entry, l2_addr, len);
     }
 
     return old_entry;
@@ -274,6 +334,30 @@ static void netstats_nb_update_etx(netstats_nb_t *stats, netstats_nb_result_t re
 #endif
 }
 
+static void netstats_nb_update_hist(netstats_nb_t *stats, uint32_t duration)
+{
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_HIST)
+    unsigned bucket = 0;
+
+    duration /= NETSTATS_NB_TX_HIST_MIN_US;
+    while (duration && (bucket < NETSTATS_NB_TX_HIST_BUCKETS - 1)) {
+        duration >>= 1;
+        bucket++;
+    }
+
+    /* gracefully handle overflow, keeping the shape of the histogram */
+    if (stats->tx_hist[bucket] == UINT16_MAX) {
+        for (unsigned i = 0; i < NETSTATS_NB_TX_HIST_BUCKETS; i++) {
+            stats->tx_hist[i] >>= 1;
+        }
+    }
+    stats->tx_hist[bucket]++;
+#else
+    (void)stats;
+    (void)duration;
+#endif
+}
+
 static void netstats_nb_update_time(netstats_nb_t *stats, netstats_nb_result_t result,
                                     uint32_t duration, bool fresh)
 {
@@ -369,6 +453,7 @@ netstats_nb_t *netstats_nb_update_tx(netif_t *dev, netstats_nb_result_t result,
     bool fresh = isfresh(stats);
 
     netstats_nb_update_time(stats, result, now - time_tx, fresh);
+    netstats_nb_update_hist(stats, now - time_tx);
     netstats_nb_update_etx(stats, result, transmissions, fresh);
     netstats_nb_incr_count_tx(stats, result);
 
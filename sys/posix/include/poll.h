@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup posix_poll     POSIX poll
+ * @ingroup  posix
+ * @brief   Poll implementation for RIOT
+ *
+ * Besides `poll()`, this module provides the epoll API known from Linux in
+ * @ref sys/epoll.h, which keeps the set of file descriptors to wait for
+ * between calls.
+ *
+ * [Sockets](@ref posix_sockets) are ready to read when data or a connection
+ * is waiting, and always ready to write. Other @ref sys_vfs file descriptors
+ * are always ready to read and to write.
+ *
+ * @see     [The Open Group Base Specification Issue 7]
+ *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
+ * @{
+ *
+ * @file
+ * @brief   Poll types
+ * @see     [The Open Group Base Specification Issue 7, 2018 edition,
+ *          <poll.h>](https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/basedefs/poll.h.html)
+ */
+
+#ifdef CPU_NATIVE
+/* On native, system headers may depend on system's <poll.h>. Hence,
+ * include the real poll.h here. */
+__extension__
+#include_next <poll.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   @ref core_thread_flags for POSIX poll
+ */
+#define POSIX_POLL_THREAD_FLAG      (1U << 4)
+
+#ifndef CPU_NATIVE
+
+/**
+ * @name    Events for `struct pollfd`
+ * @{
+ */
+#define POLLIN      (0x0001)    /**< Data other than high-priority data may
+                                 *   be read without blocking */
+#define POLLPRI     (0x0002)    /**< High priority data may be read without
+                                 *   blocking */
+#define POLLOUT     (0x0004)    /**< Normal data may be written without
+                                 *   blocking */
+#define POLLERR     (0x0008)    /**< An error has occurred
+                                 *   (revents only) */
+#define POLLHUP     (0x0010)    /**< Device has been disconnected
+                                 *   (revents only) */
+#define POLLNVAL    (0x0020)    /**< Invalid fd member (revents only) */
+#define POLLRDNORM  (0x0040)    /**< Normal data may be read without
+                                 *   blocking */
+#define POLLRDBAND  (0x0080)    /**< Priority data may be read without
+                                 *   blocking */
+#define POLLWRNORM  (0x0100)    /**< Equivalent to POLLOUT */
+#define POLLWRBAND  (0x0200)    /**< Priority data may be written */
+/** @} */
+
+/**
+ * @brief   Type for the number of file descriptors passed to poll()
+ */
+typedef unsigned int nfds_t;
+
+/**
+ * @brief   A file descriptor to wait for
+ */
+struct pollfd {
+    int fd;             /**< The file descriptor, ignored if negative */
+    short events;       /**< The events of interest */
+    short revents;      /**< The events that occurred */
+};
+
+/**
+ * @brief   Waits for one of a set of file descriptors to become ready
+ *
+ * @param[in,out] fds   The file descriptors to wait for.
+ *                      pollfd::revents is set to the events that occurred.
+ * @param[in] nfds      Number of entries in @p fds.
+ * @param[in] timeout   Time to wait in milliseconds. 0 to return
+ *                      immediately, -1 to wait indefinitely.
+ *
+ * @return  Number of entries in @p fds with events that occurred, 0 if the
+ *          timeout expired first.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#endif /* CPU_NATIVE */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
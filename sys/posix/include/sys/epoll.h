@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup  posix_poll
+ * @{
+ *
+ * @file
+ * @brief   epoll API as known from Linux
+ *
+ * Unlike for `poll()` and `select()`, the file descriptors to wait for are
+ * registered once with `epoll_ctl()`. Sockets report when they become
+ * readable, so `epoll_wait()` only looks at the file descriptors that are
+ * ready instead of checking all of them on every call.
+ *
+ * Differences to Linux:
+ * - only [sockets](@ref posix_sockets) can be registered
+ * - a socket can only be registered with one epoll instance at a time
+ * - closing a socket does not remove it from the epoll instance; remove it
+ *   with `EPOLL_CTL_DEL` before
+ *
+ * @see     [epoll(7)](https://man7.org/linux/man-pages/man7/epoll.7.html)
+ */
+
+#ifdef CPU_NATIVE
+/* On native, system headers may depend on system's <sys/epoll.h>. Hence,
+ * include the real sys/epoll.h here. */
+__extension__
+#include_next <sys/epoll.h>
+#endif
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup  config_posix
+ * @{
+ */
+/**
+ * @brief   Maximum number of epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_NUMOF
+#define CONFIG_POSIX_EPOLL_NUMOF        (1U)
+#endif
+
+/**
+ * @brief   Maximum number of file descriptors per epoll instance
+ */
+#ifndef CONFIG_POSIX_EPOLL_FDS_NUMOF
+#define CONFIG_POSIX_EPOLL_FDS_NUMOF    (8U)
+#endif
+/** @} */
+
+#ifndef CPU_NATIVE
+
+/**
+ * @name    Operations for epoll_ctl()
+ * @{
+ */
+#define EPOLL_CTL_ADD   (1)     /**< Register a file descriptor */
+#define EPOLL_CTL_DEL   (2)     /**< Remove a file descriptor */
+#define EPOLL_CTL_MOD   (3)     /**< Change the events of a file descriptor */
+/** @} */
+
+/**
+ * @name    Events for `struct epoll_event`
+ * @{
+ */
+#define EPOLLIN         (0x001U)        /**< Ready to read */
+#define EPOLLPRI        (0x002U)        /**< Priority data to read */
+#define EPOLLOUT        (0x004U)        /**< Ready to write */
+#define EPOLLERR        (0x008U)        /**< An error has occurred */
+#define EPOLLHUP        (0x010U)        /**< Hang up */
+#define EPOLLONESHOT    (1U << 30)      /**< Disable the file descriptor after
+                                         *   it was reported once */
+#define EPOLLET         (1U << 31)      /**< Report only when the file
+                                         *   descriptor becomes ready */
+/** @} */
+
+/**
+ * @brief   Flag for epoll_create1(), ignored
+ */
+#define EPOLL_CLOEXEC   (02000000)
+
+/**
+ * @brief   User data of a registered file descriptor
+ */
+typedef union epoll_data {
+    void *ptr;          /**< pointer */
+    int fd;             /**< file descriptor */
+    uint32_t u32;       /**< 32-bit value */
+    uint64_t u64;       /**< 64-bit value */
+} epoll_data_t;
+
+/**
+ * @brief   Events of a file descriptor
+ */
+struct epoll_event {
+    uint32_t events;    /**< The events of interest or that occurred */
+    epoll_data_t data;  /**< User data */
+};
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] size  Ignored, but must be greater than 0.
+ *
+ * @return  A file descriptor for the epoll instance, close with `close()`.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_create(int size);
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] flags 0 or EPOLL_CLOEXEC.
+ *
+ * @return  A file descriptor for the epoll instance, close with `close()`.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief   Registers, changes or removes a file descriptor of an epoll
+ *          instance
+ *
+ * @param[in] epfd  The epoll instance.
+ * @param[in] op    EPOLL_CTL_ADD, EPOLL_CTL_MOD or EPOLL_CTL_DEL.
+ * @param[in] fd    A socket.
+ * @param[in] event The events of interest and user data of @p fd.
+ *                  May be `NULL` for EPOLL_CTL_DEL.
+ *
+ * @return  0 on success.
+ * @return  -1 on error, `errno` is set to indicate the error. `EBUSY`, if
+ *          @p fd is registered with another epoll instance.
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief   Waits for registered file descriptors to become ready
+ *
+ * @param[in] epfd      The epoll instance.
+ * @param[out] events   The events that occurred.
+ * @param[in] maxevents Maximum number of entries in @p events.
+ * @param[in] timeout   Time to wait in milliseconds. 0 to return
+ *                      immediately, -1 to wait indefinitely.
+ *
+ * @return  Number of entries in @p events, 0 if the timeout expired first.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout);
+
+#endif /* CPU_NATIVE */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
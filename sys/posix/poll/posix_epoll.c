@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ * @brief   epoll implementation
+ *
+ * Every registered socket calls back into its epoll instance when it
+ * received data. The callback marks the socket in a bitfield of ready
+ * candidates, so epoll_wait() only needs to check the marked sockets. When
+ * the socket is closed, the callback removes it from the instance.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/epoll.h>
+
+#include "bitfield.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_POSIX_SOCKETS)
+extern bool posix_socket_is(int fd);
+extern unsigned posix_socket_avail(int fd);
+extern int posix_socket_watch(int fd, void (*cb)(void *, bool), void *arg);
+#else   /* MODULE_POSIX_SOCKETS */
+static inline bool posix_socket_is(int fd)
+{
+    (void)fd;
+    return false;
+}
+
+static inline unsigned posix_socket_avail(int fd)
+{
+    (void)fd;
+    return 0;
+}
+
+static inline int posix_socket_watch(int fd, void (*cb)(void *, bool),
+                                     void *arg)
+{
+    (void)fd;
+    (void)cb;
+    (void)arg;
+    return 0;
+}
+#endif  /* IS_USED(MODULE_POSIX_SOCKETS) */
+
+#define EPOLL_FD_UNUSED     (-1)
+
+/* events that can be reported for sockets */
+#define EPOLL_EVENTS        (EPOLLIN | EPOLLOUT)
+
+typedef struct {
+    int fd;
+    uint32_t events;
+    epoll_data_t data;
+} _epoll_fd_t;
+
+typedef struct {
+    _epoll_fd_t fds[CONFIG_POSIX_EPOLL_FDS_NUMOF];
+    /* sockets that may be ready, set from the network stack's thread */
+    BITFIELD(ready, CONFIG_POSIX_EPOLL_FDS_NUMOF);
+    thread_t *waiting_thread;
+    bool used;
+} _epoll_t;
+
+static _epoll_t _epolls[CONFIG_POSIX_EPOLL_NUMOF];
+static mutex_t _epolls_mutex = MUTEX_INIT;
+
+/* called by the sockets when they received data or were closed, the argument
+ * is the entry of the socket in _epoll_t::fds */
+static void _watch_cb(void *arg, bool closed)
+{
+    _epoll_fd_t *entry = arg;
+
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        _epoll_t *ep = &_epolls[i];
+
+        if ((entry >= &ep->fds[0]) &&
+            (entry < &ep->fds[CONFIG_POSIX_EPOLL_FDS_NUMOF])) {
+            thread_t *waiting = ep->waiting_thread;
+
+            if (closed) {
+                /* as on Linux, closing a file removes it from the instance */
+                entry->fd = EPOLL_FD_UNUSED;
+                bf_unset_atomic(ep->ready, entry - &ep->fds[0]);
+                return;
+            }
+            bf_set_atomic(ep->ready, entry - &ep->fds[0]);
+            if (waiting) {
+                thread_flags_set(waiting, POSIX_POLL_THREAD_FLAG);
+            }
+            return;
+        }
+    }
+}
+
+static int _epoll_close(vfs_file_t *filp)
+{
+    _epoll_t *ep = filp->private_data.ptr;
+
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FDS_NUMOF; i++) {
+        if (ep->fds[i].fd != EPOLL_FD_UNUSED) {
+            posix_socket_watch(ep->fds[i].fd, NULL, &ep->fds[i]);
+        }
+    }
+    mutex_lock(&_epolls_mutex);
+    ep->used = false;
+    mutex_unlock(&_epolls_mutex);
+    return 0;
+}
+
+static const vfs_file_ops_t _epoll_ops = {
+    .close = _epoll_close,
+};
+
+static _epoll_t *_get_epoll(int epfd)
+{
+    const vfs_file_t *file = vfs_file_get(epfd);
+
+    if ((file == NULL) || (file->f_op != &_epoll_ops)) {
+        return NULL;
+    }
+    return file->private_data.ptr;
+}
+
+static _epoll_fd_t *_get_entry(_epoll_t *ep, int fd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FDS_NUMOF; i++) {
+        if (ep->fds[i].fd == fd) {
+            return &ep->fds[i];
+        }
+    }
+    return NULL;
+}
+
+int epoll_create1(int flags)
+{
+    _epoll_t *ep = NULL;
+    int res;
+
+    if (flags & ~EPOLL_CLOEXEC) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&_epolls_mutex);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        if (!_epolls[i].used) {
+            ep = &_epolls[i];
+            ep->used = true;
+            break;
+        }
+    }
+    mutex_unlock(&_epolls_mutex);
+    if (ep == NULL) {
+        errno = ENFILE;
+        return -1;
+    }
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FDS_NUMOF; i++) {
+        ep->fds[i].fd = EPOLL_FD_UNUSED;
+    }
+    memset(ep->ready, 0, sizeof(ep->ready));
+    ep->waiting_thread = NULL;
+    res = vfs_bind(VFS_ANY_FD, O_RDWR, &_epoll_ops, ep);
+    if (res < 0) {
+        ep->used = false;
+        errno = -res;
+        return -1;
+    }
+    return res;
+}
+
+int epoll_create(int size)
+{
+    if (size <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return epoll_create1(0);
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+    _epoll_t *ep = _get_epoll(epfd);
+    _epoll_fd_t *entry;
+
+    if ((ep == NULL) || (vfs_file_get(fd) == NULL)) {
+        errno = EBADF;
+        return -1;
+    }
+    if (fd == epfd) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (!posix_socket_is(fd)) {
+        /* as on Linux, regular files are always ready and can't be
+         * registered */
+        errno = EPERM;
+        return -1;
+    }
+    if ((op != EPOLL_CTL_DEL) && (event == NULL)) {
+        errno = EFAULT;
+        return -1;
+    }
+    entry = _get_entry(ep, fd);
+    switch (op) {
+    case EPOLL_CTL_ADD:
+        if (entry != NULL) {
+            errno = EEXIST;
+            return -1;
+        }
+        if ((entry = _get_entry(ep, EPOLL_FD_UNUSED)) == NULL) {
+            errno = ENOSPC;
+            return -1;
+        }
+        if (posix_socket_watch(fd, _watch_cb, entry) < 0) {
+            return -1;
+        }
+        entry->fd = fd;
+        break;
+    case EPOLL_CTL_MOD:
+        if (entry == NULL) {
+            errno = ENOENT;
+            return -1;
+        }
+        break;
+    case EPOLL_CTL_DEL:
+        if (entry == NULL) {
+            errno = ENOENT;
+            return -1;
+        }
+        posix_socket_watch(fd, NULL, entry);
+        entry->fd = EPOLL_FD_UNUSED;
+        bf_unset_atomic(ep->ready, entry - &ep->fds[0]);
+        return 0;
+    default:
+        errno = EINVAL;
+        return -1;
+    }
+    entry->events = event->events;
+    entry->data = event->data;
+    /* let the next epoll_wait() check the current state of the socket */
+    bf_set_atomic(ep->ready, entry - &ep->fds[0]);
+    return 0;
+}
+
+static int _collect(_epoll_t *ep, struct epoll_event *events, int maxevents)
+{
+    int num = 0;
+    int idx;
+
+    /* only the marked entries need to be checked */
+    BITFIELD(ready, CONFIG_POSIX_EPOLL_FDS_NUMOF);
+
+    memcpy(ready, ep->ready, sizeof(ready));
+    while ((num < maxevents) &&
+           ((idx = bf_find_first_set(ready, CONFIG_POSIX_EPOLL_FDS_NUMOF)) >= 0)) {
+        _epoll_fd_t *entry = &ep->fds[idx];
+        uint32_t revents = entry->events & EPOLLOUT;
+
+        bf_unset(ready, idx);
+        /* unmark before checking, so data received in between marks it
+         * again */
+        bf_unset_atomic(ep->ready, idx);
+        if ((entry->events & EPOLLIN) && (posix_socket_avail(entry->fd) > 0)) {
+            revents |= EPOLLIN;
+        }
+        revents &= EPOLL_EVENTS;
+        if (revents == 0) {
+            continue;
+        }
+        events[num].events = revents;
+        events[num].data = entry->data;
+        num++;
+        if (entry->events & EPOLLONESHOT) {
+            /* disabled until re-armed with EPOLL_CTL_MOD */
+            entry->events = 0;
+        }
+        else if (!(entry->events & EPOLLET)) {
+            /* level-triggered: report again until it is not ready anymore */
+            bf_set_atomic(ep->ready, idx);
+        }
+    }
+    return num;
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout)
+{
+    _epoll_t *ep = _get_epoll(epfd);
+    ztimer_t timeout_timer = { .callback = NULL };
+    int num;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if ((events == NULL) || (maxevents <= 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (ep->waiting_thread != NULL) {
+        /* only one thread may wait on an instance at a time */
+        errno = EBUSY;
+        return -1;
+    }
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    ep->waiting_thread = thread_get_active();
+    num = _collect(ep, events, maxevents);
+    if ((num > 0) || (timeout == 0)) {
+        goto out;
+    }
+    if (timeout > 0) {
+        ztimer_set_timeout_flag(ZTIMER_MSEC, &timeout_timer, timeout);
+    }
+    do {
+        thread_flags_t flags = thread_flags_wait_any(POSIX_POLL_THREAD_FLAG |
+                                                     THREAD_FLAG_TIMEOUT);
+
+        num = _collect(ep, events, maxevents);
+        if (flags & THREAD_FLAG_TIMEOUT) {
+            break;
+        }
+    } while (num == 0);
+    if (timeout > 0) {
+        ztimer_remove(ZTIMER_MSEC, &timeout_timer);
+    }
+out:
+    ep->waiting_thread = NULL;
+    return num;
+}
+
+/** @} */
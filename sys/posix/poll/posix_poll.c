@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <sys/select.h>
+
+#include "thread_flags.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_POSIX_SOCKETS)
+extern bool posix_socket_is(int fd);
+extern unsigned posix_socket_avail(int fd);
+extern int posix_socket_select(int fd);
+#else   /* MODULE_POSIX_SOCKETS */
+static inline bool posix_socket_is(int fd)
+{
+    (void)fd;
+    return false;
+}
+
+static inline unsigned posix_socket_avail(int fd)
+{
+    (void)fd;
+    return 0;
+}
+
+static inline int posix_socket_select(int fd)
+{
+    (void)fd;
+    return 0;
+}
+#endif  /* IS_USED(MODULE_POSIX_SOCKETS) */
+
+static short _revents(const struct pollfd *pfd)
+{
+    struct stat buf;
+
+    if (posix_socket_is(pfd->fd)) {
+        short revents = pfd->events & (POLLOUT | POLLWRNORM);
+
+        if (posix_socket_avail(pfd->fd) > 0) {
+            revents |= pfd->events & (POLLIN | POLLRDNORM);
+        }
+        return revents;
+    }
+    /* any other file never blocks */
+    if (vfs_fstat(pfd->fd, &buf) == 0) {
+        return pfd->events & (POLLIN | POLLRDNORM | POLLOUT | POLLWRNORM);
+    }
+    return POLLNVAL;
+}
+
+static int _check(struct pollfd fds[], nfds_t nfds)
+{
+    int ready = 0;
+
+    for (nfds_t i = 0; i < nfds; i++) {
+        fds[i].revents = (fds[i].fd < 0) ? 0 : _revents(&fds[i]);
+        if (fds[i].revents) {
+            ready++;
+        }
+    }
+    return ready;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    ztimer_t timeout_timer = { .callback = NULL };
+    int ready;
+
+    if ((fds == NULL) && (nfds > 0)) {
+        errno = EFAULT;
+        return -1;
+    }
+    if (nfds > VFS_MAX_OPEN_FILES) {
+        errno = EINVAL;
+        return -1;
+    }
+    /* register for notifications before checking the sockets, so no data
+     * received in between gets missed */
+    thread_flags_clear(POSIX_SELECT_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    for (nfds_t i = 0; (timeout != 0) && (i < nfds); i++) {
+        if ((fds[i].fd >= 0) && (fds[i].events & (POLLIN | POLLRDNORM)) &&
+            posix_socket_is(fds[i].fd)) {
+            if (posix_socket_select(fds[i].fd) < 0) {
+                return -1;
+            }
+        }
+    }
+    ready = _check(fds, nfds);
+    if ((ready > 0) || (timeout == 0)) {
+        return ready;
+    }
+    if (timeout > 0) {
+        ztimer_set_timeout_flag(ZTIMER_MSEC, &timeout_timer, timeout);
+    }
+    do {
+        thread_flags_t flags = thread_flags_wait_any(POSIX_SELECT_THREAD_FLAG |
+                                                     THREAD_FLAG_TIMEOUT);
+
+        ready = _check(fds, nfds);
+        if (flags & THREAD_FLAG_TIMEOUT) {
+            break;
+        }
+    } while (ready == 0);
+    if (timeout > 0) {
+        ztimer_remove(ZTIMER_MSEC, &timeout_timer);
+    }
+    return ready;
+}
+
+/** @} */
@@ -41,7 +41,7 @@
 #if IS_USED(MODULE_SOCK_ASYNC)
 #include "net/sock/async.h"
 #endif
-#if IS_USED(MODULE_POSIX_SELECT)
+#if IS_USED(MODULE_POSIX_SELECT) || IS_USED(MODULE_POSIX_POLL)
 #include <sys/select.h>
 
 #include "thread.h"
@@ -93,8 +93,13 @@ typedef struct {
 #if IS_USED(MODULE_SOCK_ASYNC)
     atomic_uint available;
 #endif
-#if IS_USED(MODULE_POSIX_SELECT)
+#if IS_USED(MODULE_POSIX_SELECT) || IS_USED(MODULE_POSIX_POLL)
     thread_t *selecting_thread;
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+    /* called when data was received or the socket is closed */
+    void (*watch_cb)(void *arg, bool closed);
+    void *watch_arg;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
 } socket_t;
@@ -125,8 +130,11 @@ static socket_t *_get_free_socket(void)
 #if IS_USED(MODULE_SOCK_ASYNC)
             atomic_init(&_socket_pool[i].available, 0U);
 #endif
-#if IS_USED(MODULE_POSIX_SELECT)
+#if IS_USED(MODULE_POSIX_SELECT) || IS_USED(MODULE_POSIX_POLL)
             _socket_pool[i].selecting_thread = NULL;
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+            _socket_pool[i].watch_cb = NULL;
 #endif
             return &_socket_pool[i];
         }
@@ -289,6 +297,16 @@ static int socket_close(vfs_file_t *filp)
     int res = 0;
 
     assert((s->domain == AF_INET) || (s->domain == AF_INET6));
+#if IS_USED(MODULE_POSIX_POLL)
+    void (*watch_cb)(void *, bool) = s->watch_cb;
+
+    s->watch_cb = NULL;
+    if (watch_cb) {
+        /* the file descriptor may be reused, so the watcher must forget it */
+        watch_cb(s->watch_arg, true);
+    }
+    s->watch_arg = NULL;
+#endif
     mutex_lock(&_socket_pool_mutex);
     if (s->sock != NULL) {
         int idx = _get_sock_idx(s->sock);
@@ -372,11 +390,18 @@ static void _async_cb(void *sock, sock_async_flags_t type,
     (void)sock;
     if (type & SOCK_ASYNC_MSG_RECV) {
         atomic_fetch_add(&socket->available, 1);
-#if IS_USED(MODULE_POSIX_SELECT)
+#if IS_USED(MODULE_POSIX_SELECT) || IS_USED(MODULE_POSIX_POLL)
         if (socket->selecting_thread) {
             thread_flags_set(socket->selecting_thread,
                              POSIX_SELECT_THREAD_FLAG);
         }
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+        void (*watch_cb)(void *, bool) = socket->watch_cb;
+
+        if (watch_cb) {
+            watch_cb(socket->watch_arg, false);
+        }
 #endif
     }
 }
@@ -944,9 +969,15 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
     }
 
 #ifdef POSIX_SETSOCKOPT
-    const uint32_t recv_timeout = s->recv_timeout;
+    uint32_t recv_timeout = s->recv_timeout;
 #else
-    const uint32_t recv_timeout = SOCK_NO_TIMEOUT;
+    uint32_t recv_timeout = SOCK_NO_TIMEOUT;
+#endif
+#ifdef MODULE_SOCK_ASYNC
+    if ((s->type != SOCK_STREAM) && (atomic_load(&s->available) > 0)) {
+        /* a datagram is already queued, so there is no need to block */
+        recv_timeout = 0;
+    }
 #endif
 
     switch (s->type) {
@@ -975,10 +1006,18 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         res = -EOPNOTSUPP;
         break;
     }
-    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
 #ifdef MODULE_SOCK_ASYNC
-        atomic_fetch_sub(&s->available, 1);
+    if (res >= 0) {
+        unsigned available = atomic_load(&s->available);
+
+        /* received data is consumed regardless of the peer's address being
+         * asked for */
+        while ((available > 0) &&
+               !atomic_compare_exchange_weak(&s->available, &available,
+                                             available - 1)) {}
+    }
 #endif
+    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
         switch (s->type) {
 #ifdef MODULE_SOCK_TCP
         case SOCK_STREAM:
@@ -1194,7 +1233,7 @@ unsigned posix_socket_avail(int fd)
 
 int posix_socket_select(int fd)
 {
-#if IS_USED(MODULE_POSIX_SELECT)
+#if IS_USED(MODULE_POSIX_SELECT) || IS_USED(MODULE_POSIX_POLL)
     socket_t *socket = _get_socket(fd);
 
     if (socket != NULL) {
@@ -1216,6 +1255,44 @@ int posix_socket_select(int fd)
     return -1;
 }
 
+int posix_socket_watch(int fd, void (*cb)(void *, bool), void *arg)
+{
+#if IS_USED(MODULE_POSIX_POLL)
+    socket_t *socket = _get_socket(fd);
+
+    if (socket != NULL) {
+        if ((socket->watch_cb != NULL) && (socket->watch_arg != arg)) {
+            if (cb == NULL) {
+                /* watched by someone else */
+                return 0;
+            }
+            errno = EBUSY;
+            return -1;
+        }
+        if ((cb != NULL) && (socket->sock == NULL)) {
+            int res;
+
+            /* bind implicitly */
+            if ((res = _bind_connect(socket, NULL, 0)) < 0) {
+                return res;
+            }
+        }
+        /* set the argument first, the callback may be called from the network
+         * stack's thread at any time */
+        socket->watch_cb = NULL;
+        socket->watch_arg = arg;
+        socket->watch_cb = cb;
+        return 0;
+    }
+#else
+    (void)fd;
+    (void)cb;
+    (void)arg;
+#endif
+    errno = ENOTSUP;
+    return -1;
+}
+
 /**
  * @}
  */
@@ -54,6 +54,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_PROFILE
+           "| preempted | latency_max "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -120,6 +123,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_PROFILE
+                   "|  %8u | %11"PRIu32" "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -133,6 +139,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_PROFILE
+                   , sched_pidlist[i].preempted, sched_pidlist[i].latency.max_us
 #endif
                   );
         }
@@ -149,4 +158,7 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+#ifdef MODULE_SCHEDSTATISTICS_PROFILE
+    printf("\tIRQ latency: %" PRIu32 " us at most\n", sched_irq_latency.max_us);
+#endif
 }
@@ -38,6 +38,17 @@ psa_status_t psa_write_encoded_key_slot_to_file(psa_key_id_t id,
                                                      uint8_t* input,
                                                      size_t input_len);
 
+/**
+ * @brief   Check whether a key is in persistent storage, without reading it
+ *
+ * @param   id      ID of the desired key
+ *
+ * @return  @ref PSA_SUCCESS
+ * @return  @ref PSA_ERROR_DOES_NOT_EXIST   No key with this ID is stored
+ * @return  @ref PSA_ERROR_STORAGE_FAILURE
+ */
+psa_status_t psa_find_persistent_key(psa_key_id_t id);
+
 /**
  * @brief   Reads a CBOR encoded key slot from a file
  *
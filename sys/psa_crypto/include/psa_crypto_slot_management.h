@@ -209,6 +209,21 @@ void psa_wipe_all_key_slots(void);
  */
 psa_status_t psa_get_and_lock_key_slot(psa_key_id_t id, psa_key_slot_t **slot);
 
+/**
+ * @brief   Remove the copy of a persistent key from local memory
+ *
+ *          The key slot is wiped, unless the key is volatile or in use. The key is read
+ *          from storage again on its next use.
+ *
+ * @param   id      ID of the key to be purged
+ *
+ * @return  @ref PSA_SUCCESS                Also if the key is stored but not in local memory
+ * @return  @ref PSA_ERROR_INVALID_HANDLE   No key with this ID exists
+ * @return  @ref PSA_ERROR_STORAGE_FAILURE
+ * @return  @ref PSA_ERROR_CORRUPTION_DETECTED
+ */
+psa_status_t psa_purge_key_slot(psa_key_id_t id);
+
 /**
  * @brief   Store a key slot in persistent storage
  *
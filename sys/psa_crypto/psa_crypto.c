@@ -1318,6 +1318,15 @@ psa_status_t psa_destroy_key(psa_key_id_t key)
     return psa_wipe_key_slot(slot);
 }
 
+psa_status_t psa_purge_key(psa_key_id_t key)
+{
+    if (!lib_initialized) {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    return psa_purge_key_slot(key);
+}
+
 /**
  * @brief   Export key that is stored in local memory
  *
@@ -1959,11 +1968,6 @@ psa_status_t psa_mac_verify_setup(psa_mac_operation_t *operation,
     return PSA_ERROR_NOT_SUPPORTED;
 }
 
-psa_status_t psa_purge_key(psa_key_id_t key)
-{
-    (void)key;
-    return PSA_ERROR_NOT_SUPPORTED;
-}
 #endif /* MODULE_PSA_MAC */
 
 #if IS_USED(MODULE_PSA_KEY_AGREEMENT)
@@ -18,6 +18,9 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <string.h>
+
 #include "clist.h"
 #include "psa_crypto_slot_management.h"
 #include "architecture.h"
@@ -93,6 +96,35 @@ static clist_node_t key_slot_list;
  */
 static psa_key_id_t key_id_count = PSA_KEY_ID_VOLATILE_MIN;
 
+/**
+ * @brief   Number of entries in the key slot index
+ *
+ *          More than twice the number of key slots, so that lookups rarely have to probe
+ *          more than one or two entries. The extra entry keeps the table valid in builds
+ *          without any key slots.
+ */
+#define KEY_SLOT_INDEX_SIZE     (2 * PSA_KEY_SLOT_COUNT + 1)
+
+/**
+ * @brief   Entry of the key slot index
+ */
+typedef struct {
+    psa_key_slot_t *slot;       /**< Slot holding the key, NULL if the entry is empty */
+    psa_key_id_t id;            /**< ID of the key in the slot */
+    uint32_t last_use;          /**< Value of @ref key_slot_use_count at the last lookup */
+} key_slot_index_entry_t;
+
+/**
+ * @brief   Hash table with linear probing, mapping the IDs of all keys in local memory to
+ *          their key slots
+ */
+static key_slot_index_entry_t key_slot_index[KEY_SLOT_INDEX_SIZE];
+
+/**
+ * @brief   Counter incremented on every lookup, to find the least recently used key.
+ */
+static uint32_t key_slot_use_count;
+
 /**
  * @brief   Get the correct empty slot list, depending on the key type
  *
@@ -158,6 +190,99 @@ void psa_init_key_slots(void)
     DEBUG("Single Key Slot Array Size: %" PRIuSIZE "\n", sizeof(single_key_slots));
     DEBUG("Single Key Slot Empty List Size: %" PRIuSIZE "\n", clist_count(&single_key_list_empty));
 #endif /* PSA_SINGLE_KEY_COUNT */
+
+    memset(key_slot_index, 0, sizeof(key_slot_index));
+}
+
+/**
+ * @brief   Get the home position of a key ID in the key slot index
+ *
+ * @param   id  Key ID
+ *
+ * @return  Index of the first entry to probe
+ */
+static unsigned psa_key_slot_index_hash(psa_key_id_t id)
+{
+    /* Fibonacci hashing spreads consecutive and strided IDs alike */
+    return (uint32_t)(id * 2654435761U) % KEY_SLOT_INDEX_SIZE;
+}
+
+/**
+ * @brief   Find the index entry of a key
+ *
+ * @param   id  ID of the required key
+ *
+ * @return  Pointer to the entry
+ *          NULL if the key is not in local memory
+ */
+static key_slot_index_entry_t *psa_key_slot_index_find(psa_key_id_t id)
+{
+    unsigned i = psa_key_slot_index_hash(id);
+
+    while (key_slot_index[i].slot != NULL) {
+        if (key_slot_index[i].id == id) {
+            return &key_slot_index[i];
+        }
+        i = (i + 1) % KEY_SLOT_INDEX_SIZE;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief   Add a key slot to the index
+ *
+ * @param   id      ID of the key stored in the slot
+ * @param   slot    Key slot
+ */
+static void psa_key_slot_index_add(psa_key_id_t id, psa_key_slot_t *slot)
+{
+    unsigned i = psa_key_slot_index_hash(id);
+
+    /* There are more entries than slots, so there always is an empty one */
+    while (key_slot_index[i].slot != NULL) {
+        i = (i + 1) % KEY_SLOT_INDEX_SIZE;
+    }
+
+    key_slot_index[i].slot = slot;
+    key_slot_index[i].id = id;
+    key_slot_index[i].last_use = ++key_slot_use_count;
+}
+
+/**
+ * @brief   Remove a key slot from the index
+ *
+ * @param   slot    Key slot
+ */
+static void psa_key_slot_index_remove(const psa_key_slot_t *slot)
+{
+    /* Search for the slot itself, key creation may have failed before its ID was set */
+    unsigned hole = psa_key_slot_index_hash(slot->attr.id);
+    unsigned n;
+
+    for (n = 0; n < KEY_SLOT_INDEX_SIZE; n++) {
+        if (key_slot_index[hole].slot == slot) {
+            break;
+        }
+        hole = (hole + 1) % KEY_SLOT_INDEX_SIZE;
+    }
+    if (n == KEY_SLOT_INDEX_SIZE) {
+        return;
+    }
+
+    /* Move following entries of the same probe sequence back, so that no lookup
+       stops early at the new empty entry */
+    for (unsigned i = (hole + 1) % KEY_SLOT_INDEX_SIZE; key_slot_index[i].slot != NULL;
+         i = (i + 1) % KEY_SLOT_INDEX_SIZE) {
+        unsigned home = psa_key_slot_index_hash(key_slot_index[i].id);
+
+        /* The entry may only move if its home is not cyclically within (hole, i] */
+        if ((i > hole) ? ((home <= hole) || (home > i)) : ((home <= hole) && (home > i))) {
+            key_slot_index[hole] = key_slot_index[i];
+            hole = i;
+        }
+    }
+    key_slot_index[hole].slot = NULL;
 }
 
 /**
@@ -205,6 +330,8 @@ psa_status_t psa_wipe_key_slot(psa_key_slot_t *slot)
 
     psa_key_slot_t *tmp = container_of(n, psa_key_slot_t, node);
 
+    psa_key_slot_index_remove(tmp);
+
     /* Wipe slot associated with node */
     psa_wipe_real_slot_type(tmp);
 
@@ -224,50 +351,9 @@ void psa_wipe_all_key_slots(void)
         psa_wipe_real_slot_type(slot);
         clist_rpush(empty_list, to_remove);
     }
-}
-
-/**
- * @brief   Check whether a given key ID equals the ID of the given node.
- *
- *          This is the break condition of the @ref clist_foreach function used
- *          in @ref psa_get_and_lock_key_slot_in_memory.
- *          clist_foreach iterates over all key slots and calls this function
- *          to compare each slot's key ID to the given input key ID.
- *          If they are equal, this function returns True and breaks the foreach
- *          loop.
- *
- *          For more information see core/lib/include/clist.h.
- *
- * @param   n   Pointer to clist node referencing a key slot
- * @param   arg Pointer to required key ID
- * @return  int
- *          1 if input ID equals node ID
- *          0 otherwise
- */
-static int node_id_equals_key_id(clist_node_t *n, void *arg)
-{
-    psa_key_slot_t *slot = container_of(n, psa_key_slot_t, node);
-    psa_key_id_t id = *((psa_key_id_t *)arg);
-
-    if (slot->attr.id == id) {
-        return 1;
-    }
-
-    return 0;
-}
 
-#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
-static int node_lifetime_is_persistent(clist_node_t *n, void *arg)
-{
-    psa_key_slot_t *slot = container_of(n, psa_key_slot_t, node);
-    if (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) {
-        return 1;
-    }
-
-    (void) arg;
-    return 0;
+    memset(key_slot_index, 0, sizeof(key_slot_index));
 }
-#endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
 /**
  * @brief   Find the key slot containing the key with a specified ID
@@ -284,12 +370,14 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(psa_key_id_t id, psa_key
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 
-    clist_node_t *slot_node = clist_foreach(&key_slot_list, node_id_equals_key_id, &id);
-    if (slot_node == NULL) {
+    key_slot_index_entry_t *entry = psa_key_slot_index_find(id);
+    if (entry == NULL) {
         return PSA_ERROR_DOES_NOT_EXIST;
     }
 
-    psa_key_slot_t *slot = container_of(slot_node, psa_key_slot_t, node);
+    entry->last_use = ++key_slot_use_count;
+
+    psa_key_slot_t *slot = entry->slot;
     status = psa_lock_key_slot(slot);
     if (status == PSA_SUCCESS) {
         *p_slot = slot;
@@ -354,20 +442,44 @@ psa_status_t psa_persist_key_slot_in_storage(psa_key_slot_t *slot)
 }
 
 /**
- * @brief   Find and wipe a persistent key slot in local storage to make room for a new key
+ * @brief   Find and wipe the least recently used persistent key in local memory to make room
+ *          for a new key
+ *
+ *          Only unlocked slots of the type belonging to @p empty_list are considered, the key
+ *          can be read from storage again when it is needed.
+ *
+ * @param   empty_list  List of empty slots of the required type
  *
  * @return  PSA_SUCCESS
- * @return  PSA_ERROR_INSUFFICIENT_STORAGE  No persistent key found in local storage
+ * @return  PSA_ERROR_INSUFFICIENT_STORAGE  No evictable persistent key found in local memory
  *          PSA_ERROR_DOES_NOT_EXIST
  */
-static psa_status_t psa_find_and_wipe_persistent_key_from_local_storage(void)
+static psa_status_t psa_find_and_wipe_persistent_key_from_local_storage(
+                                                            const clist_node_t *empty_list)
 {
-    clist_node_t *slot_node = clist_foreach(&key_slot_list, node_lifetime_is_persistent, NULL);
-    if (slot_node == NULL) {
+    key_slot_index_entry_t *lru = NULL;
+
+    for (unsigned i = 0; i < KEY_SLOT_INDEX_SIZE; i++) {
+        psa_key_slot_t *slot = key_slot_index[i].slot;
+
+        if ((slot == NULL) || (slot->lock_count > 0) ||
+            PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime) ||
+            (psa_get_empty_key_slot_list(&slot->attr) != empty_list)) {
+            continue;
+        }
+        /* Compare the difference, the use counter may have wrapped around */
+        if ((lru == NULL) ||
+            ((int32_t)(key_slot_index[i].last_use - lru->last_use) < 0)) {
+            lru = &key_slot_index[i];
+        }
+    }
+
+    if (lru == NULL) {
         return PSA_ERROR_INSUFFICIENT_STORAGE;
     }
 
-    return psa_wipe_key_slot(container_of(slot_node, psa_key_slot_t, node));
+    DEBUG("Key Slot MGMT: Evicting persistent key %" PRIu32 "\n", (uint32_t)lru->id);
+    return psa_wipe_key_slot(lru->slot);
 }
 #endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
@@ -390,6 +502,37 @@ psa_status_t psa_get_and_lock_key_slot(psa_key_id_t id, psa_key_slot_t **p_slot)
     return status;
 }
 
+psa_status_t psa_purge_key_slot(psa_key_id_t id)
+{
+    psa_key_slot_t *slot;
+    psa_status_t status;
+
+    if (!psa_is_valid_key_id(id, 1)) {
+        return PSA_ERROR_INVALID_HANDLE;
+    }
+
+    status = psa_get_and_lock_key_slot_in_memory(id, &slot);
+    if (status == PSA_ERROR_DOES_NOT_EXIST) {
+#if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
+        /* A stored key that is not in local memory has nothing to purge */
+        if (!psa_key_id_is_volatile(id)) {
+            status = psa_find_persistent_key(id);
+        }
+#endif /* MODULE_PSA_PERSISTENT_STORAGE */
+        return (status == PSA_ERROR_DOES_NOT_EXIST ? PSA_ERROR_INVALID_HANDLE : status);
+    }
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    /* Only drop the copy of a persistent key that is not in use elsewhere */
+    if (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime) && (slot->lock_count <= 1)) {
+        return psa_wipe_key_slot(slot);
+    }
+
+    return psa_unlock_key_slot(slot);
+}
+
 /**
  * @brief   Allocate a free slot for a new key creation
  *
@@ -414,7 +557,7 @@ static psa_status_t psa_allocate_key_slot_in_list(psa_key_slot_t **p_slot,
 #if IS_USED(MODULE_PSA_PERSISTENT_STORAGE)
         /* If no slots left: Look for slot in list with persistent key
            (key will be stored in persistent memory and slot can be reused) */
-        psa_status_t status = psa_find_and_wipe_persistent_key_from_local_storage();
+        psa_status_t status = psa_find_and_wipe_persistent_key_from_local_storage(empty_list);
         if (status != PSA_SUCCESS) {
             DEBUG("Key Slot MGMT: No PSA Key Slot available\n");
             return status;
@@ -476,6 +619,7 @@ psa_status_t psa_allocate_empty_key_slot(psa_key_id_t *id,
             DEBUG("Key Slot MGMT: invalid lifetime or ID\n");
             return PSA_ERROR_INVALID_ARGUMENT;
         }
+        psa_key_slot_index_add(*id, new_slot);
         *p_slot = new_slot;
 
         return PSA_SUCCESS;
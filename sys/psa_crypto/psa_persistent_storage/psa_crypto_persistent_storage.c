@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <fcntl.h>
 #include "psa/crypto.h"
 #include "psa_crypto_slot_management.h"
@@ -75,6 +76,26 @@ psa_status_t psa_write_encoded_key_slot_to_file(psa_key_id_t id,
     return PSA_SUCCESS;
 }
 
+psa_status_t psa_find_persistent_key(psa_key_id_t id)
+{
+    char string_path[STRING_PATH_LEN];
+
+    sprintf(string_path, "%s/%d", vfs_mountpoints_xfa[0].mount_point, (int) id);
+
+    int fd = vfs_open(string_path, O_RDONLY, 0);
+    if (fd < 0) {
+        DEBUG("[psa_crypto] find persisted key: Can not open file: %d\n", fd);
+        return (fd == -ENOENT ? PSA_ERROR_DOES_NOT_EXIST : PSA_ERROR_STORAGE_FAILURE);
+    }
+
+    if (vfs_close(fd) != 0) {
+        DEBUG("[psa_crypto] find persisted key: Can not close file: %d\n", fd);
+        return PSA_ERROR_STORAGE_FAILURE;
+    }
+
+    return PSA_SUCCESS;
+}
+
 psa_status_t psa_read_encoded_key_slot_from_file(psa_key_id_t id,
                                                      uint8_t *output,
                                                      size_t output_size,
@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include "architecture.h"
+#include "modules.h"
 #include "riotboot/flashwrite.h"
 #include "riotboot/slot.h"
 #include "od.h"
@@ -154,7 +155,10 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
             else {
-                flashpage_write((uint8_t *)addr + flashpage_pos,
+                /* write the whole buffer, which starts at the block boundary
+                 * before the position this chunk was copied to */
+                flashpage_write((uint8_t *)addr + flashpage_pos -
+                                flashwrite_buffer_pos,
                                 state->flashpage_buf,
                                 RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
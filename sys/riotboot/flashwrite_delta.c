@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_riotboot_flashwrite_delta
+ * @{
+ *
+ * @file
+ * @brief       Streaming delta update stage for the riotboot flash writer
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "riotboot/flashwrite_delta.h"
+#include "riotboot/slot.h"
+
+#define LOG_PREFIX "riotboot_flashwrite_delta: "
+#include "log.h"
+
+static inline size_t min(size_t a, size_t b)
+{
+    return a <= b ? a : b;
+}
+
+static int _slot_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    riotboot_flashwrite_delta_t *delta = dev;
+
+    if (offset + len > riotboot_slot_size(delta->source_slot)) {
+        return -EINVAL;
+    }
+
+    memcpy(dest, (uint8_t *)riotboot_slot_get_hdr(delta->source_slot) + offset,
+           len);
+    return 0;
+}
+
+static const vcdiff_driver_t _slot_driver = {
+    .read = _slot_read,
+};
+
+static int _target_erase(void *dev, size_t offset, size_t len)
+{
+    /* riotboot_flashwrite_putbytes() erases the pages it writes to */
+    (void)dev;
+    (void)offset;
+    (void)len;
+    return 0;
+}
+
+static int _target_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    riotboot_flashwrite_delta_t *delta = dev;
+    riotboot_flashwrite_t *writer = delta->writer;
+    const uint8_t *slot =
+        (const uint8_t *)riotboot_slot_get_hdr(writer->target_slot);
+    /* start of the data that is still held in the write buffer */
+    size_t pending = writer->offset -
+                     (writer->offset % RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+
+    if (offset + len > writer->offset) {
+        return -EINVAL;
+    }
+
+    while (len) {
+        const uint8_t *src;
+        size_t avail;
+
+        if (offset < delta->skip) {
+            src = &delta->head[offset];
+            avail = delta->skip - offset;
+        }
+        else if (offset >= pending) {
+            src = &writer->flashpage_buf[offset - pending];
+            avail = writer->offset - offset;
+        }
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+        else if (offset < RIOTBOOT_FLASHPAGE_BUFFER_SIZE) {
+            /* the first block is only written by riotboot_flashwrite_finish() */
+            src = &writer->firstblock_buf[offset];
+            avail = RIOTBOOT_FLASHPAGE_BUFFER_SIZE - offset;
+        }
+#endif
+        else {
+            src = &slot[offset];
+            avail = pending - offset;
+        }
+
+        size_t n = min(avail, len);
+        memcpy(dest, src, n);
+        dest += n;
+        offset += n;
+        len -= n;
+    }
+
+    return 0;
+}
+
+static int _target_write(void *dev, uint8_t *src, size_t offset, size_t len)
+{
+    riotboot_flashwrite_delta_t *delta = dev;
+    riotboot_flashwrite_t *writer = delta->writer;
+
+    if (offset + len > riotboot_flashwrite_slotsize(writer)) {
+        LOG_WARNING(LOG_PREFIX "image exceeds target slot\n");
+        return -ENOSPC;
+    }
+
+    if (offset < delta->skip) {
+        size_t n = min(delta->skip - offset, len);
+        memcpy(&delta->head[offset], src, n);
+        offset += n;
+        src += n;
+        len -= n;
+    }
+
+    if (!len) {
+        return 0;
+    }
+
+    if (offset != writer->offset) {
+        LOG_ERROR(LOG_PREFIX "unexpected offset %u, expected %u\n",
+                  (unsigned)offset, (unsigned)writer->offset);
+        return -EINVAL;
+    }
+
+    return riotboot_flashwrite_putbytes(writer, src, len, true) ? -EIO : 0;
+}
+
+static int _target_flush(void *dev)
+{
+    /* the write buffer is flushed by riotboot_flashwrite_delta_finish() */
+    (void)dev;
+    return 0;
+}
+
+static const vcdiff_driver_t _target_driver = {
+    .erase = _target_erase,
+    .read = _target_read,
+    .write = _target_write,
+    .flush = _target_flush,
+};
+
+static int _init(riotboot_flashwrite_delta_t *delta,
+                 riotboot_flashwrite_t *writer)
+{
+    if (writer->offset > sizeof(delta->head)) {
+        return -EINVAL;
+    }
+
+    delta->writer = writer;
+    delta->skip = writer->offset;
+    memset(delta->head, 0, sizeof(delta->head));
+
+    vcdiff_init(&delta->vcdiff);
+    vcdiff_set_target_driver(&delta->vcdiff, &_target_driver, delta);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA_HEATSHRINK)
+    heatshrink_decoder_reset(&delta->hsd);
+#endif
+
+    return 0;
+}
+
+int riotboot_flashwrite_delta_init(riotboot_flashwrite_delta_t *delta,
+                                   riotboot_flashwrite_t *writer,
+                                   int source_slot)
+{
+    assert(source_slot != writer->target_slot);
+
+    int res = _init(delta, writer);
+    if (res) {
+        return res;
+    }
+
+    LOG_INFO(LOG_PREFIX "applying delta to slot %i\n", source_slot);
+
+    delta->source_slot = source_slot;
+    vcdiff_set_source_driver(&delta->vcdiff, &_slot_driver, delta);
+
+    return 0;
+}
+
+#if IS_USED(MODULE_TINYVCDIFF_MTD)
+int riotboot_flashwrite_delta_init_mtd(riotboot_flashwrite_delta_t *delta,
+                                       riotboot_flashwrite_t *writer,
+                                       mtd_dev_t *source)
+{
+    int res = _init(delta, writer);
+    if (res) {
+        return res;
+    }
+
+    LOG_INFO(LOG_PREFIX "applying delta to MTD device\n");
+
+    delta->source_slot = -1;
+    delta->source_mtd = (vcdiff_mtd_t)VCDIFF_MTD_INIT(source);
+    vcdiff_set_source_driver(&delta->vcdiff, &vcdiff_mtd_driver,
+                             &delta->source_mtd);
+
+    return 0;
+}
+#endif
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA_HEATSHRINK)
+static int _decompress(riotboot_flashwrite_delta_t *delta)
+{
+    HSD_poll_res poll;
+
+    do {
+        size_t n;
+
+        poll = heatshrink_decoder_poll(&delta->hsd, delta->buf,
+                                       sizeof(delta->buf), &n);
+        if (poll < 0) {
+            return -EINVAL;
+        }
+        if (n) {
+            int res = vcdiff_apply_delta(&delta->vcdiff, delta->buf, n);
+            if (res < 0) {
+                return res;
+            }
+        }
+    } while (poll == HSDR_POLL_MORE);
+
+    return 0;
+}
+#endif
+
+int riotboot_flashwrite_delta_putbytes(riotboot_flashwrite_delta_t *delta,
+                                       const uint8_t *bytes, size_t len)
+{
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA_HEATSHRINK)
+    while (len) {
+        size_t n;
+
+        if (heatshrink_decoder_sink(&delta->hsd, (uint8_t *)bytes, len,
+                                    &n) < 0) {
+            return -EINVAL;
+        }
+        bytes += n;
+        len -= n;
+
+        int res = _decompress(delta);
+        if (res < 0) {
+            LOG_WARNING(LOG_PREFIX "applying delta failed: %d\n", res);
+            return res;
+        }
+    }
+
+    return 0;
+#else
+    int res = vcdiff_apply_delta(&delta->vcdiff, bytes, len);
+    if (res < 0) {
+        LOG_WARNING(LOG_PREFIX "applying delta failed: %d\n", res);
+    }
+    return res < 0 ? res : 0;
+#endif
+}
+
+int riotboot_flashwrite_delta_finish(riotboot_flashwrite_delta_t *delta)
+{
+    int res;
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_DELTA_HEATSHRINK)
+    while (heatshrink_decoder_finish(&delta->hsd) == HSDR_FINISH_MORE) {
+        res = _decompress(delta);
+        if (res < 0) {
+            return res;
+        }
+    }
+#endif
+
+    res = vcdiff_finish(&delta->vcdiff);
+    if (res < 0) {
+        LOG_WARNING(LOG_PREFIX "incomplete delta: %d\n", res);
+        return res;
+    }
+
+    LOG_INFO(LOG_PREFIX "reconstructed %u bytes\n",
+             (unsigned)delta->writer->offset);
+
+    return riotboot_flashwrite_flush(delta->writer);
+}
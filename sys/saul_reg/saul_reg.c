@@ -18,11 +18,13 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 
+#include "kernel_defines.h"
 #include "saul_reg.h"
 
 /**
@@ -30,10 +32,84 @@
  */
 saul_reg_t *saul_reg = NULL;
 
-int saul_reg_add(saul_reg_t *dev)
+/**
+ * @brief   Last device of the list, so that adding a device does not have to
+ *          walk the list
+ */
+static saul_reg_t *_last = NULL;
+
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+/* open addressing tables of the first device of every type and of every name,
+ * devices are never removed, so an empty slot ends every probe sequence */
+static saul_reg_t *_type_index[CONFIG_SAUL_REG_INDEX_SIZE];
+static saul_reg_t *_name_index[CONFIG_SAUL_REG_INDEX_SIZE];
+/* set once a type or a name did not fit, lookups that miss in the table
+ * have to walk the registry then */
+static bool _type_full;
+static bool _name_full;
+
+static unsigned _name_hash(const char *name)
 {
-    saul_reg_t *tmp = saul_reg;
+    /* FNV-1a, names often only differ in their last characters */
+    uint32_t hash = 2166136261U;
+
+    while (*name) {
+        hash = (hash ^ (unsigned char)*name++) * 16777619U;
+    }
+    return hash % CONFIG_SAUL_REG_INDEX_SIZE;
+}
+
+static saul_reg_t **_type_slot(uint8_t type)
+{
+    unsigned pos = type % CONFIG_SAUL_REG_INDEX_SIZE;
+
+    for (unsigned i = 0; i < CONFIG_SAUL_REG_INDEX_SIZE; i++) {
+        saul_reg_t **slot = &_type_index[pos];
+        if ((*slot == NULL) || ((*slot)->driver->type == type)) {
+            return slot;
+        }
+        pos = (pos + 1) % CONFIG_SAUL_REG_INDEX_SIZE;
+    }
+    return NULL;
+}
+
+static saul_reg_t **_name_slot(const char *name)
+{
+    unsigned pos = _name_hash(name);
+
+    for (unsigned i = 0; i < CONFIG_SAUL_REG_INDEX_SIZE; i++) {
+        saul_reg_t **slot = &_name_index[pos];
+        if ((*slot == NULL) || (strcmp((*slot)->name, name) == 0)) {
+            return slot;
+        }
+        pos = (pos + 1) % CONFIG_SAUL_REG_INDEX_SIZE;
+    }
+    return NULL;
+}
 
+static void _index_add(saul_reg_t *dev)
+{
+    saul_reg_t **slot = _type_slot(dev->driver->type);
+
+    if (slot == NULL) {
+        _type_full = true;
+    }
+    else if (*slot == NULL) {
+        *slot = dev;
+    }
+
+    slot = _name_slot(dev->name);
+    if (slot == NULL) {
+        _name_full = true;
+    }
+    else if (*slot == NULL) {
+        *slot = dev;
+    }
+}
+#endif
+
+int saul_reg_add(saul_reg_t *dev)
+{
     if (dev == NULL) {
         return -ENODEV;
     }
@@ -45,11 +121,12 @@ int saul_reg_add(saul_reg_t *dev)
         saul_reg = dev;
     }
     else {
-        while (tmp->next != NULL) {
-            tmp = tmp->next;
-        }
-        tmp->next = dev;
+        _last->next = dev;
     }
+    _last = dev;
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    _index_add(dev);
+#endif
     return 0;
 }
 
@@ -67,6 +144,13 @@ saul_reg_t *saul_reg_find_type(uint8_t type)
 {
     saul_reg_t *tmp = saul_reg;
 
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    saul_reg_t **slot = _type_slot(type);
+
+    if ((slot != NULL) && ((*slot != NULL) || !_type_full)) {
+        return *slot;
+    }
+#endif
     while (tmp) {
         if (tmp->driver->type == type) {
             return tmp;
@@ -80,6 +164,13 @@ saul_reg_t *saul_reg_find_name(const char *name)
 {
     saul_reg_t *tmp = saul_reg;
 
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    saul_reg_t **slot = _name_slot(name);
+
+    if ((slot != NULL) && ((*slot != NULL) || !_name_full)) {
+        return *slot;
+    }
+#endif
     while (tmp) {
         if (strcmp(tmp->name, name) == 0) {
             return tmp;
@@ -93,6 +184,14 @@ saul_reg_t *saul_reg_find_type_and_name(uint8_t type, const char *name)
 {
     saul_reg_t *tmp = saul_reg;
 
+#if IS_USED(MODULE_SAUL_REG_INDEX)
+    /* all devices of that name are registered after the first one */
+    saul_reg_t **slot = _name_slot(name);
+
+    if ((slot != NULL) && ((*slot != NULL) || !_name_full)) {
+        tmp = *slot;
+    }
+#endif
     while (tmp) {
         if (tmp->driver->type == type && strcmp(tmp->name, name) == 0) {
             return tmp;
@@ -110,6 +209,24 @@ int saul_reg_read(saul_reg_t *dev, phydat_t *res)
     return dev->driver->read(dev->dev, res);
 }
 
+size_t saul_reg_read_many(saul_reg_t *const *devs, size_t num, phydat_t *res,
+                          int *dims)
+{
+    size_t done = 0;
+
+    for (size_t i = 0; i < num; i++) {
+        int dim = saul_reg_read(devs[i], &res[i]);
+
+        if (dim > 0) {
+            done++;
+        }
+        if (dims) {
+            dims[i] = dim;
+        }
+    }
+    return done;
+}
+
 int saul_reg_write(saul_reg_t *dev, const phydat_t *data)
 {
     if (dev == NULL) {
@@ -21,6 +21,11 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
@@ -32,6 +37,54 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE)
+schedstat_hist_t sched_irq_latency;
+
+/* ZTIMER_USEC is not usable before init_schedstatistics() */
+static bool _started;
+
+static void _hist_add(schedstat_hist_t *hist, uint32_t latency)
+{
+    unsigned bucket = latency ? bitarithm_msb(latency) : 0;
+
+    if (bucket >= CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS) {
+        bucket = CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS - 1;
+    }
+    hist->count[bucket]++;
+    if (latency > hist->max_us) {
+        hist->max_us = latency;
+    }
+}
+
+void sched_statistics_runnable(kernel_pid_t pid)
+{
+    if (_started) {
+        sched_pidlist[pid].runnable_since = ztimer_now(ZTIMER_USEC);
+    }
+}
+
+static void _profile_switch(kernel_pid_t active_thread,
+                            kernel_pid_t next_thread, uint32_t now)
+{
+    if (active_thread != KERNEL_PID_UNDEF) {
+        const thread_t *thread = thread_get(active_thread);
+
+        /* the thread is gone, if it just exited */
+        if (thread && (thread_get_status(thread) >= STATUS_ON_RUNQUEUE)) {
+            sched_pidlist[active_thread].preempted++;
+            sched_pidlist[active_thread].runnable_since = now;
+        }
+        else if (thread) {
+            sched_pidlist[active_thread].voluntary++;
+        }
+    }
+    if (next_thread != KERNEL_PID_UNDEF) {
+        _hist_add(&sched_pidlist[next_thread].latency,
+                  now - sched_pidlist[next_thread].runnable_since);
+    }
+}
+#endif
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = ztimer_now(ZTIMER_USEC);
@@ -48,7 +101,73 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         next_stat->laststart = now;
         next_stat->schedules++;
     }
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE)
+    _profile_switch(active_thread, next_thread, now);
+#endif
+}
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE) && CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US
+static ztimer_t _sample_timer;
+static uint32_t _sample_due;
+
+static void _sample_stack(void)
+{
+#ifdef DEVELHELP
+    /* one thread per period, scanning the stacks takes a while */
+    static kernel_pid_t pid = KERNEL_PID_LAST;
+
+    for (unsigned i = 0; i < MAXTHREADS; i++) {
+        pid = (pid == KERNEL_PID_LAST) ? KERNEL_PID_FIRST : pid + 1;
+
+        const thread_t *thread = thread_get(pid);
+
+        if (thread) {
+            unsigned used = thread_get_stacksize(thread) -
+                            thread_measure_stack_free(thread);
+            if (used > sched_pidlist[pid].stack_used) {
+                sched_pidlist[pid].stack_used = used;
+            }
+            return;
+        }
+    }
+#endif
+}
+
+static void _sample(void *arg)
+{
+    (void)arg;
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    _hist_add(&sched_irq_latency, now - _sample_due);
+    _sample_stack();
+
+    _sample_due = now + CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US;
+    ztimer_set(ZTIMER_USEC, &_sample_timer,
+               CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US);
+}
+#endif
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE)
+void sched_statistics_reset(void)
+{
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        schedstat_t *stat = &sched_pidlist[pid];
+
+        stat->voluntary = 0;
+        stat->preempted = 0;
+        memset(&stat->latency, 0, sizeof(stat->latency));
+        stat->stack_used = 0;
+        /* only matters for runnable threads, others get a new one on wakeup */
+        stat->runnable_since = now;
+    }
+    memset(&sched_irq_latency, 0, sizeof(sched_irq_latency));
+    irq_restore(state);
 }
+#endif
 
 void init_schedstatistics(void)
 {
@@ -57,5 +176,16 @@ void init_schedstatistics(void)
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
     active_stat->laststart = ztimer_now(ZTIMER_USEC);
     active_stat->schedules = 1;
+#if IS_USED(MODULE_SCHEDSTATISTICS_PROFILE)
+    sched_statistics_reset();
+    _started = true;
+#  if CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US
+    _sample_timer.callback = _sample;
+    _sample_due = ztimer_now(ZTIMER_USEC) +
+                  CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US;
+    ztimer_set(ZTIMER_USEC, &_sample_timer,
+               CONFIG_SCHEDSTATISTICS_SAMPLE_PERIOD_US);
+#  endif
+#endif
     sched_register_cb(sched_statistics_cb);
 }
@@ -50,6 +50,34 @@ static int _benchmark_udp_handler(int argc, char **argv)
             bench_port = atoi(argv[3]);
         }
     }
+    if (strcmp(argv[1], "burst") == 0) {
+        unsigned count = 1000;
+        unsigned batch = 1;
+        bool many = true;
+
+        if (argc > 2) {
+            count = atoi(argv[2]);
+        }
+        if (argc > 3) {
+            batch = atoi(argv[3]);
+        }
+        if (argc > 4) {
+            if (strcmp(argv[4], "single") == 0) {
+                many = false;
+            }
+            else if (strcmp(argv[4], "many") != 0) {
+                goto usage;
+            }
+        }
+        if (argc > 5) {
+            bench_server = argv[5];
+        }
+        if (argc > 6) {
+            bench_port = atoi(argv[6]);
+        }
+        return benchmark_udp_burst(bench_server, bench_port, count, batch,
+                                   many);
+    }
     if (strcmp(argv[1], "stop") == 0) {
         if (benchmark_udp_stop()) {
             puts("benchmark process stopped");
@@ -61,6 +89,8 @@ static int _benchmark_udp_handler(int argc, char **argv)
 
 usage:
     printf("usage: %s [start|stop|config] <server> <port>\n", argv[0]);
+    printf("       %s burst <count> <batch> [many|single] <server> <port>\n",
+           argv[0]);
     return -1;
 }
 
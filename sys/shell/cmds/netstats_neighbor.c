@@ -48,6 +48,9 @@ static void _print_neighbors(netif_t *dev)
     if (IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_TIME)) {
         header_len += printf(" avg tx time");
     }
+    if (IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_HIST)) {
+        header_len += printf(" tx time histogram");
+    }
     printf("\n");
 
     while (header_len--) {
@@ -84,9 +87,22 @@ static void _print_neighbors(netif_t *dev)
 #endif
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_TIME)
         printf(" %7"PRIu32" µs", entry->time_tx_avg);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_HIST)
+        for (unsigned j = 0; j < NETSTATS_NB_TX_HIST_BUCKETS; j++) {
+            printf(" %"PRIu16, entry->tx_hist[j]);
+        }
 #endif
         printf("\n");
     }
+
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_HIST)
+    printf("tx time histogram buckets:");
+    for (unsigned j = 0; j < NETSTATS_NB_TX_HIST_BUCKETS - 1; j++) {
+        printf(" <%lu", (unsigned long)NETSTATS_NB_TX_HIST_MIN_US << j);
+    }
+    puts(" more µs");
+#endif
 }
 
 static int _netstats_nb(int argc, char **argv)
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command printing the scheduler statistics as JSON
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "irq.h"
+#include "schedstatistics.h"
+#include "shell.h"
+#include "thread.h"
+
+static void _print_hist(const schedstat_hist_t *hist)
+{
+    printf("[");
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; i++) {
+        printf("%s%" PRIu32, i ? ", " : "", hist->count[i]);
+    }
+    printf("]");
+}
+
+static void _print_stats(void)
+{
+    schedstat_t stat;
+    schedstat_hist_t irq_latency;
+    bool first = true;
+
+    puts("{\"threads\": [");
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *thread = thread_get(pid);
+
+        if (thread == NULL) {
+            continue;
+        }
+        /* take a consistent copy, printing takes long */
+        unsigned state = irq_disable();
+        stat = sched_pidlist[pid];
+        irq_restore(state);
+
+        const char *name = thread_get_name(thread);
+        /* printf() may not support 64 bit integers */
+        char runtime[21];
+
+        runtime[fmt_u64_dec(runtime, stat.runtime_us)] = '\0';
+        printf("%s{\"pid\": %" PRIkernel_pid ", \"name\": \"%s\", "
+               "\"runtime_us\": %s, \"switches\": %u, "
+               "\"voluntary\": %u, \"preempted\": %u, "
+               "\"latency_max_us\": %" PRIu32 ", \"latency\": ",
+               first ? "" : ",\n", pid, name ? name : "",
+               runtime, stat.schedules, stat.voluntary,
+               stat.preempted, stat.latency.max_us);
+        _print_hist(&stat.latency);
+        printf(", \"stack_used\": %u}", stat.stack_used);
+        first = false;
+    }
+
+    unsigned state = irq_disable();
+    irq_latency = sched_irq_latency;
+    irq_restore(state);
+
+    printf("\n], \"irq_latency_max_us\": %" PRIu32 ", \"irq_latency\": ",
+           irq_latency.max_us);
+    _print_hist(&irq_latency);
+    puts("}");
+}
+
+static int _schedstat_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        _print_stats();
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        sched_statistics_reset();
+        return 0;
+    }
+    printf("usage: %s [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(schedstat, "Prints scheduler statistics as JSON",
+              _schedstat_handler);
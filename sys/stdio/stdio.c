@@ -39,7 +39,7 @@ void stdio_init(void)
     }
 }
 
-ssize_t stdio_write(const void* buffer, size_t len)
+ssize_t STDIO_WRITE_BACKEND(const void* buffer, size_t len)
 {
     for (unsigned i = 0; i < XFA_LEN(stdio_provider_t, stdio_provider_xfa); ++i) {
         stdio_provider_xfa[i].write(buffer, len);
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_stdio_tx_async
+ * @{
+ *
+ * @file
+ * @brief       Buffered STDIO output implementation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "stdio_base.h"
+#include "stdio_tx_async.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "tsrb.h"
+
+#define STDIO_TX_ASYNC_THREAD_FLAG      (1U << 0)
+
+static_assert((CONFIG_STDIO_TX_ASYNC_BUFSIZE &
+               (CONFIG_STDIO_TX_ASYNC_BUFSIZE - 1)) == 0,
+              "CONFIG_STDIO_TX_ASYNC_BUFSIZE must be a power of two");
+
+static uint8_t _buf[CONFIG_STDIO_TX_ASYNC_BUFSIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+
+/* serializes handing chunks to the backend, so they stay in order */
+static mutex_t _backend_lock = MUTEX_INIT;
+static uint8_t _chunk[CONFIG_STDIO_TX_ASYNC_CHUNK_SIZE];
+
+static stdio_tx_async_stats_t _stats;
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static char _stack[CONFIG_STDIO_TX_ASYNC_STACKSIZE];
+
+/* needs _backend_lock */
+static bool _write_chunk(void)
+{
+    int len = tsrb_get(&_rb, _chunk, sizeof(_chunk));
+
+    if (len <= 0) {
+        return false;
+    }
+    stdio_write_blocking(_chunk, len);
+
+    unsigned state = irq_disable();
+    _stats.written += len;
+    irq_restore(state);
+    return true;
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_flags_wait_any(STDIO_TX_ASYNC_THREAD_FLAG);
+        /* release the lock between chunks, so writers that need space don't
+         * wait for the whole buffer */
+        bool more;
+        do {
+            mutex_lock(&_backend_lock);
+            more = _write_chunk();
+            mutex_unlock(&_backend_lock);
+        } while (more);
+    }
+    return NULL;
+}
+
+void auto_init_stdio_tx_async(void)
+{
+    _pid = thread_create(_stack, sizeof(_stack), CONFIG_STDIO_TX_ASYNC_PRIO,
+                         0, _thread, NULL, "stdio_tx");
+    /* output from before */
+    if (!tsrb_empty(&_rb)) {
+        thread_flags_set(thread_get(_pid), STDIO_TX_ASYNC_THREAD_FLAG);
+    }
+}
+
+/* adds @p len bytes of @p data to the ring buffer as a whole or drops them */
+static void _queue(const void *data, size_t len)
+{
+    unsigned state = irq_disable();
+
+    /* drop the output as a whole rather than garbling it */
+    if (tsrb_free(&_rb) < len) {
+        _stats.dropped += len;
+        _stats.drops++;
+    }
+    else {
+        /* the thread writes until the buffer is empty, so it only needs to
+         * be woken up when there was nothing to write before */
+        bool wake = tsrb_empty(&_rb) && (_pid != KERNEL_PID_UNDEF);
+
+        tsrb_add(&_rb, data, len);
+        if (wake) {
+            thread_flags_set(thread_get(_pid), STDIO_TX_ASYNC_THREAD_FLAG);
+        }
+    }
+    irq_restore(state);
+}
+
+/* writes the buffered output and @p len bytes of @p buffer right away, when
+ * there is no thread to hand it over to or blocking is not allowed */
+static ssize_t _write_now(const void *buffer, size_t len)
+{
+    if (!mutex_trylock(&_backend_lock)) {
+        /* the code holding the lock was interrupted while writing a chunk
+         * and writes the buffered output next, so queue the output behind
+         * it to keep the order */
+        _queue(buffer, len);
+        return len;
+    }
+    while (_write_chunk()) {}
+
+    unsigned state = irq_disable();
+    _stats.written += len;
+    irq_restore(state);
+
+    ssize_t res = stdio_write_blocking(buffer, len);
+
+    mutex_unlock(&_backend_lock);
+    return res;
+}
+
+ssize_t stdio_write(const void *buffer, size_t len)
+{
+    const uint8_t *data = buffer;
+    size_t left = len;
+
+    if (irq_is_in() || !irq_is_enabled() || (_pid == KERNEL_PID_UNDEF)) {
+        return _write_now(buffer, len);
+    }
+    /* output that can never fit is passed through the buffer piece by piece
+     * below instead */
+    if (!IS_ACTIVE(CONFIG_STDIO_TX_ASYNC_BLOCK) &&
+        (len <= CONFIG_STDIO_TX_ASYNC_BUFSIZE)) {
+        _queue(buffer, len);
+        return len;
+    }
+    while (left) {
+        /* output queued from interrupt context must not interleave */
+        unsigned state = irq_disable();
+        int added = tsrb_add(&_rb, data, left);
+
+        irq_restore(state);
+        data += added;
+        left -= added;
+        if (left) {
+            /* make space by writing to the backend in this thread */
+            mutex_lock(&_backend_lock);
+            _write_chunk();
+            mutex_unlock(&_backend_lock);
+        }
+    }
+    thread_flags_set(thread_get(_pid), STDIO_TX_ASYNC_THREAD_FLAG);
+    return len;
+}
+
+void stdio_tx_async_flush(void)
+{
+    if (irq_is_in() || !irq_is_enabled()) {
+        if (mutex_trylock(&_backend_lock)) {
+            while (_write_chunk()) {}
+            mutex_unlock(&_backend_lock);
+        }
+        return;
+    }
+    mutex_lock(&_backend_lock);
+    while (_write_chunk()) {}
+    mutex_unlock(&_backend_lock);
+}
+
+void stdio_tx_async_stats(stdio_tx_async_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = _stats;
+    irq_restore(state);
+}
@@ -43,6 +43,9 @@
 #ifdef MODULE_SUIT_TRANSPORT_VFS
 #include "suit/transport/vfs.h"
 #endif
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+#include "suit/transport/pipeline.h"
+#endif
 #include "suit/transport/mock.h"
 
 #if defined(MODULE_PROGRESS_BAR)
@@ -382,7 +385,18 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
 
     _print_download_progress(manifest, offset, len, image_size);
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    int res = suit_transport_pipeline_write(manifest, buf, offset, len);
+    if (!more) {
+        /* The backend must not be finalized while blocks are in flight */
+        res = suit_transport_pipeline_flush();
+        if (res < 0) {
+            return res;
+        }
+    }
+#else
     int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
+#endif
     if (!more) {
         LOG_INFO("Finalizing payload store\n");
         /* Finalize the write if no more data available */
@@ -439,6 +453,13 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
         return SUIT_ERR_STORAGE;
     }
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    if (suit_transport_pipeline_start(manifest) < 0) {
+        LOG_ERROR("Unable to start payload pipeline\n");
+        return SUIT_ERR_STORAGE;
+    }
+#endif
+
     res = -1;
 
     if (0) {}
@@ -469,6 +490,9 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 
     if (res) {
         suit_component_set_flag(comp, SUIT_COMPONENT_STATE_FETCH_FAILED);
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+        suit_transport_pipeline_invalidate();
+#endif
         /* TODO: The leftover data from a failed fetch should be purged. It
          * could contain potential malicious data from an attacker */
         LOG_INFO("image download failed with code %i\n", res);
@@ -499,12 +523,22 @@ static int _get_digest(nanocbor_value_t *bstr, const uint8_t **digest, size_t
     return nanocbor_get_bstr(&arr_it, digest, digest_len);
 }
 
-static int _validate_payload(suit_component_t *component, const uint8_t *digest,
+static int _validate_payload(suit_manifest_t *manifest,
+                             suit_component_t *component, const uint8_t *digest,
                              size_t payload_size)
 {
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    /* Use the digest computed during the download, if there is one */
+    if (suit_transport_pipeline_digest(manifest, payload_size,
+                                       payload_digest) == SUIT_OK) {
+        return (memcmp(digest, payload_digest, SHA256_DIGEST_LENGTH) == 0) ?
+            SUIT_OK : SUIT_ERR_DIGEST_MISMATCH;
+    }
+#endif
+
     if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
@@ -577,7 +611,7 @@ static int _dtv_verify_image_match(suit_manifest_t *manifest, int key,
 
     /* TODO: replace with generic verification (not only sha256) */
     LOG_INFO("Starting digest verification against image\n");
-    res = _validate_payload(comp, digest, img_size);
+    res = _validate_payload(manifest, comp, digest, img_size);
     if (res == SUIT_OK) {
         if (!suit_component_check_flag(comp, SUIT_COMPONENT_STATE_INSTALLED)) {
             LOG_INFO("Install correct payload\n");
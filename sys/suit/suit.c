@@ -30,6 +30,9 @@
 #include "suit/handlers.h"
 #include "suit/policy.h"
 #include "suit.h"
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+#include "suit/transport/pipeline.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -43,7 +46,12 @@ int suit_parse(suit_manifest_t *manifest, const uint8_t *buf,
     manifest->len = len;
     nanocbor_decoder_init(&it, buf, len);
     LOG_DEBUG("Starting envelope sequence handler\n");
-    return suit_handle_manifest_structure(manifest, &it,
-                                          suit_envelope_handlers,
-                                          suit_envelope_handlers_len);
+    int res = suit_handle_manifest_structure(manifest, &it,
+                                             suit_envelope_handlers,
+                                             suit_envelope_handlers_len);
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    /* a streamed digest must not be used by a later manifest */
+    suit_transport_pipeline_invalidate();
+#endif
+    return res;
 }
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_transport_pipeline
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined payload storage
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "macros/utils.h"
+#include "mbox.h"
+#include "sema.h"
+#include "thread.h"
+
+#include "suit.h"
+#include "suit/storage.h"
+#include "suit/transport/pipeline.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifndef SUIT_TRANSPORT_PIPELINE_STACKSIZE
+/* the storage backend's write function runs on this stack */
+#define SUIT_TRANSPORT_PIPELINE_STACKSIZE   THREAD_STACKSIZE_LARGE
+#endif
+
+#ifndef SUIT_TRANSPORT_PIPELINE_PRIO
+/* one below the default SUIT worker priority, so that the worker can request
+ * the next block before the current one is written */
+#define SUIT_TRANSPORT_PIPELINE_PRIO        THREAD_PRIORITY_MAIN
+#endif
+
+/* Number of pipeline buffers, one is filled while the other one is written */
+#define PIPELINE_NUMOF                      (2U)
+
+typedef struct {
+    suit_storage_t *storage;            /**< storage backend to write to */
+    const suit_manifest_t *manifest;    /**< manifest being processed */
+    size_t offset;                      /**< offset of the data in the payload */
+    size_t len;                         /**< number of bytes in buf */
+    uint8_t buf[CONFIG_SUIT_TRANSPORT_PIPELINE_BUFSIZE];
+} _block_t;
+
+static char _stack[SUIT_TRANSPORT_PIPELINE_STACKSIZE];
+static kernel_pid_t _writer_pid = KERNEL_PID_UNDEF;
+
+static _block_t _blocks[PIPELINE_NUMOF];
+/* next buffer to fill, buffers are written in the order they were filled */
+static unsigned _next;
+static sema_t _free = SEMA_CREATE(PIPELINE_NUMOF);
+static msg_t _queue_buf[PIPELINE_NUMOF];
+static mbox_t _queue = MBOX_INIT(_queue_buf, PIPELINE_NUMOF);
+/* result of the first failed write, written only by the writer thread while
+ * it owns a buffer */
+static int _res;
+
+/* streamed digest of the current component, only valid for the manifest,
+ * component, storage backend and location it was computed for */
+static sha256_context_t _sha256;
+static const suit_manifest_t *_manifest;
+static const suit_component_t *_component;
+static const suit_storage_t *_storage;
+static char _location[CONFIG_SUIT_COMPONENT_MAX_NAME_LEN];
+static size_t _hashed;
+static bool _in_order;
+
+static int _get_location(const suit_manifest_t *manifest,
+                         const suit_component_t *comp,
+                         char *buf, size_t len)
+{
+    char separator = suit_storage_get_separator(comp->storage_backend);
+
+    return suit_component_name_to_string(manifest, comp, separator, buf, len);
+}
+
+static void *_writer_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t m;
+
+        mbox_get(&_queue, &m);
+        _block_t *block = m.content.ptr;
+
+        if (_res == SUIT_OK) {
+            int res = suit_storage_write(block->storage, block->manifest,
+                                         block->buf, block->offset, block->len);
+            if (res < 0) {
+                DEBUG("suit_pipeline: writing %" PRIuSIZE " bytes at %" PRIuSIZE
+                      " failed: %d\n", block->len, block->offset, res);
+                _res = res;
+            }
+        }
+        sema_post(&_free);
+    }
+
+    return NULL;
+}
+
+int suit_transport_pipeline_flush(void)
+{
+    for (unsigned i = 0; i < PIPELINE_NUMOF; i++) {
+        sema_wait(&_free);
+    }
+    for (unsigned i = 0; i < PIPELINE_NUMOF; i++) {
+        sema_post(&_free);
+    }
+    return _res;
+}
+
+int suit_transport_pipeline_start(const suit_manifest_t *manifest)
+{
+    assert(manifest->component_current < CONFIG_SUIT_COMPONENT_MAX);
+
+    if (_writer_pid == KERNEL_PID_UNDEF) {
+        _writer_pid = thread_create(_stack, sizeof(_stack),
+                                    SUIT_TRANSPORT_PIPELINE_PRIO, 0,
+                                    _writer_thread, NULL, "suit pipeline");
+        if (_writer_pid < 0) {
+            _writer_pid = KERNEL_PID_UNDEF;
+            return SUIT_ERR_NO_MEM;
+        }
+    }
+
+    /* leftovers of a failed previous fetch must not end up in this one */
+    suit_transport_pipeline_flush();
+
+    _res = SUIT_OK;
+    _manifest = manifest;
+    _component = &manifest->components[manifest->component_current];
+    _storage = _component->storage_backend;
+    _hashed = 0;
+    /* without a location, the payload is read back from storage */
+    _in_order = _get_location(manifest, _component, _location,
+                              sizeof(_location)) >= 0;
+    sha256_init(&_sha256);
+
+    return SUIT_OK;
+}
+
+void suit_transport_pipeline_invalidate(void)
+{
+    _in_order = false;
+}
+
+int suit_transport_pipeline_write(const suit_manifest_t *manifest,
+                                  const uint8_t *buf, size_t offset,
+                                  size_t len)
+{
+    const suit_component_t *comp =
+        &manifest->components[manifest->component_current];
+
+    /* Hash while the previous block is being written. Anything but a plain
+     * sequential download falls back to reading the payload back. */
+    if (_in_order && (manifest == _manifest) && (comp == _component) &&
+        (comp->storage_backend == _storage) && (offset == _hashed)) {
+        sha256_update(&_sha256, buf, len);
+        _hashed += len;
+    }
+    else {
+        _in_order = false;
+    }
+
+    while (len) {
+        sema_wait(&_free);
+        if (_res != SUIT_OK) {
+            sema_post(&_free);
+            _in_order = false;
+            break;
+        }
+
+        _block_t *block = &_blocks[_next];
+        _next = (_next + 1) % PIPELINE_NUMOF;
+
+        block->storage = comp->storage_backend;
+        block->manifest = manifest;
+        block->offset = offset;
+        block->len = MIN(len, sizeof(block->buf));
+        memcpy(block->buf, buf, block->len);
+
+        msg_t m = { .content.ptr = block };
+        mbox_put(&_queue, &m);
+
+        buf += block->len;
+        offset += block->len;
+        len -= block->len;
+    }
+
+    return _res;
+}
+
+int suit_transport_pipeline_digest(const suit_manifest_t *manifest,
+                                   size_t size,
+                                   uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    const suit_component_t *comp =
+        &manifest->components[manifest->component_current];
+    char location[CONFIG_SUIT_COMPONENT_MAX_NAME_LEN];
+
+    if (!_in_order || (manifest != _manifest) || (comp != _component) ||
+        (comp->storage_backend != _storage) || (size != _hashed)) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    /* The digest describes one download. Whatever happens to the storage
+     * afterwards, later checks have to read it back. */
+    _in_order = false;
+
+    if ((_get_location(manifest, comp, location, sizeof(location)) < 0) ||
+        (strcmp(location, _location) != 0)) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    /* the digest only counts if the data actually made it into storage */
+    if (suit_transport_pipeline_flush() != SUIT_OK) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    sha256_final(&_sha256, digest);
+
+    return SUIT_OK;
+}
@@ -142,31 +142,43 @@ static void *_send_thread(void *ctx)
     return NULL;
 }
 
-int benchmark_udp_start(const char *server, uint16_t port)
+static int _create(const char *server, uint16_t port, sock_udp_ep_t *remote)
 {
     netif_t *netif;
     sock_udp_ep_t local = { .family = AF_INET6,
                             .netif = SOCK_ADDR_ANY_NETIF,
                             .port = port };
-    sock_udp_ep_t remote = { .family = AF_INET6,
-                             .port = port };
-
-    /* stop threads first */
-    benchmark_udp_stop();
 
     if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
         puts("Error creating UDP sock");
         return 1;
     }
 
-    if (netutils_get_ipv6((ipv6_addr_t *)&remote.addr.ipv6, &netif, server) < 0) {
+    remote->family = AF_INET6;
+    remote->port = port;
+    if (netutils_get_ipv6((ipv6_addr_t *)&remote->addr.ipv6, &netif, server) < 0) {
         puts("can't resolve remote address");
+        sock_udp_close(&sock);
         return 1;
     }
     if (netif) {
-        remote.netif = netif_get_id(netif);
+        remote->netif = netif_get_id(netif);
     } else {
-        remote.netif = SOCK_ADDR_ANY_NETIF;
+        remote->netif = SOCK_ADDR_ANY_NETIF;
+    }
+
+    return 0;
+}
+
+int benchmark_udp_start(const char *server, uint16_t port)
+{
+    sock_udp_ep_t remote;
+
+    /* stop threads first */
+    benchmark_udp_stop();
+
+    if (_create(server, port, &remote)) {
+        return 1;
     }
 
     running = true;
@@ -205,6 +217,97 @@ bool benchmark_udp_stop(void)
     return true;
 }
 
+static int _burst_send(sock_udp_ep_t *remote, unsigned num, bool many)
+{
+    static uint8_t buf[BENCH_BURST_BATCH_MAX][BENCH_BURST_PAYLOAD_SIZE];
+    iolist_t snips[BENCH_BURST_BATCH_MAX];
+    sock_udp_msg_t msgs[BENCH_BURST_BATCH_MAX];
+
+    if (!many) {
+        /* back-to-back, so the same number of datagrams is in flight */
+        for (unsigned i = 0; i < num; i++) {
+            ssize_t res = sock_udp_send(&sock, buf[i], sizeof(buf[i]), remote);
+
+            if (res < 0) {
+                return (i == 0) ? res : (int)i;
+            }
+        }
+        return num;
+    }
+    for (unsigned i = 0; i < num; i++) {
+        snips[i] = (iolist_t){ .iol_base = buf[i], .iol_len = sizeof(buf[i]) };
+        msgs[i] = (sock_udp_msg_t){ .snips = &snips[i], .remote = remote };
+    }
+    return sock_udp_send_many(&sock, msgs, num);
+}
+
+static int _burst_recv(unsigned num, bool many)
+{
+    static uint8_t buf[BENCH_BURST_BATCH_MAX][BENCH_BURST_PAYLOAD_SIZE];
+    iolist_t snips[BENCH_BURST_BATCH_MAX];
+    sock_udp_msg_t msgs[BENCH_BURST_BATCH_MAX];
+
+    if (!many) {
+        ssize_t res = sock_udp_recv(&sock, buf[0], sizeof(buf[0]),
+                                    BENCH_BURST_TIMEOUT_US, NULL);
+        return (res < 0) ? res : 1;
+    }
+    for (unsigned i = 0; i < num; i++) {
+        snips[i] = (iolist_t){ .iol_base = buf[i], .iol_len = sizeof(buf[i]) };
+        msgs[i] = (sock_udp_msg_t){ .snips = &snips[i] };
+    }
+    return sock_udp_recv_many(&sock, msgs, num, BENCH_BURST_TIMEOUT_US);
+}
+
+int benchmark_udp_burst(const char *server, uint16_t port, unsigned count,
+                        unsigned batch, bool many)
+{
+    sock_udp_ep_t remote;
+    unsigned sent = 0, received = 0;
+    uint32_t start, time;
+
+    if ((batch == 0) || (batch > BENCH_BURST_BATCH_MAX)) {
+        printf("batch must be 1 to %u\n", BENCH_BURST_BATCH_MAX);
+        return 1;
+    }
+
+    benchmark_udp_stop();
+
+    if (_create(server, port, &remote)) {
+        return 1;
+    }
+
+    start = xtimer_now_usec();
+    while (sent < count) {
+        int res = _burst_send(&remote, MIN(batch, count - sent), many);
+
+        if (res < 0) {
+            printf("Error sending message: %d\n", res);
+            break;
+        }
+        sent += res;
+        /* wait for the replies before sending the next batch, they would
+         * be dropped if the receive queue of the sock overflows */
+        for (unsigned outstanding = res; outstanding > 0;) {
+            res = _burst_recv(outstanding, many);
+            if (res < 0) {
+                /* replies lost */
+                break;
+            }
+            received += res;
+            outstanding -= res;
+        }
+    }
+    time = xtimer_now_usec() - start;
+    sock_udp_close(&sock);
+
+    printf("sent %u, received %u datagrams in %" PRIu32 " us "
+           "(%" PRIu32 " datagrams/s)\n", sent, received, time,
+           (uint32_t)((uint64_t)sent * US_PER_SEC / (time ? time : 1)));
+
+    return (sent == count) ? 0 : 1;
+}
+
 void benchmark_udp_auto_init(void)
 {
     benchmark_udp_start(BENCH_SERVER_DEFAULT, BENCH_PORT_DEFAULT);
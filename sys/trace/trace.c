@@ -20,52 +20,248 @@
  * @}
  */
 
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "architecture.h"
 #include "irq.h"
+#include "sched.h"
+#include "schedstatistics.h"
+#include "thread.h"
+#include "trace.h"
 #include "ztimer.h"
 
+#ifdef CPU_NATIVE
+#include <fcntl.h>
+#include "native_internal.h"
+#endif
+
 #ifndef CONFIG_TRACE_BUFSIZE
 #define CONFIG_TRACE_BUFSIZE 512
 #endif
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+static_assert((CONFIG_TRACE_BUFSIZE & (CONFIG_TRACE_BUFSIZE - 1)) == 0,
+              "CONFIG_TRACE_BUFSIZE must be a power of two");
+static_assert(sizeof(trace_entry_t) == 12, "trace_entry_t must be packed");
+static_assert(sizeof(trace_export_hdr_t) == 16,
+              "trace_export_hdr_t must be packed");
+static_assert(sizeof(trace_export_thread_t) == 16,
+              "trace_export_thread_t must be packed");
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+static trace_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
+/* number of entries ever reserved, wraps around */
+static atomic_uint tracebuf_pos;
+/* set once ZTIMER_USEC can be read, cleared while exporting */
+static volatile bool tracebuf_enabled;
+
+static void _record(uint8_t id, uint8_t pid, uint32_t arg)
+{
+    if (!tracebuf_enabled) {
+        return;
+    }
+
+    /* reserving the entry is all that needs to be atomic, an interrupting
+     * writer just takes the next one */
+    unsigned pos = atomic_fetch_add_explicit(&tracebuf_pos, 1,
+                                             memory_order_relaxed);
+    trace_entry_t *entry = &tracebuf[pos & (CONFIG_TRACE_BUFSIZE - 1)];
+
+    *entry = (trace_entry_t){
+        .time = ztimer_now(ZTIMER_USEC),
+        .arg = arg,
+        .id = id,
+        .pid = pid,
+        .flags = irq_is_in() ? TRACE_FLAG_ISR : 0,
+    };
+}
 
 void trace(uint32_t val)
 {
-    unsigned state = irq_disable();
+    _record(TRACE_EV_USER, thread_getpid(), val);
+}
+
+void trace_event(uint8_t id, uint32_t arg)
+{
+    _record(id, thread_getpid(), arg);
+}
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = ztimer_now(ZTIMER_USEC), .val = val };
-    tracebuf_pos++;
-    irq_restore(state);
+/* returns the number of valid entries, the oldest one is at @p first */
+static unsigned _entries(unsigned *first)
+{
+    unsigned pos = atomic_load_explicit(&tracebuf_pos, memory_order_relaxed);
+    unsigned n = pos > CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : pos;
+
+    *first = pos - n;
+    return n;
 }
 
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    unsigned first;
+    unsigned n = _entries(&first);
     uint32_t t_last = 0;
 
-    for (size_t i = 0; i < n; i++) {
-        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, tracebuf[i].val);
-        t_last = tracebuf[i].time;
+    for (unsigned i = 0; i < n; i++) {
+        const trace_entry_t *entry =
+            &tracebuf[(first + i) & (CONFIG_TRACE_BUFSIZE - 1)];
+
+        printf("n=%4u t=%s%8" PRIu32 " v=0x%08" PRIx32, i, i ? "+" : " ",
+               entry->time - t_last, entry->arg);
+        if (entry->id != TRACE_EV_USER) {
+            printf(" e=%u p=%u%s", entry->id, entry->pid,
+                   (entry->flags & TRACE_FLAG_ISR) ? " isr" : "");
+        }
+        puts("");
+        t_last = entry->time;
     }
 }
 
+void trace_export(trace_write_cb_t write, void *arg)
+{
+    trace_export_hdr_t hdr = {
+        .magic = TRACE_EXPORT_MAGIC,
+        .version = TRACE_EXPORT_VERSION,
+        .entry_size = sizeof(trace_entry_t),
+        .byteorder = (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__),
+    };
+    bool enabled = tracebuf_enabled;
+    unsigned first;
+
+    tracebuf_enabled = false;
+    hdr.entries = _entries(&first);
+    hdr.lost = first;
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid)) {
+            hdr.threads++;
+        }
+    }
+    write(&hdr, sizeof(hdr), arg);
+
+    /* threads may come and go in between, stick to the announced number */
+    unsigned threads = 0;
+    for (kernel_pid_t pid = KERNEL_PID_FIRST;
+         (pid <= KERNEL_PID_LAST) && (threads < hdr.threads); pid++) {
+        const thread_t *thread = thread_get(pid);
+        trace_export_thread_t entry = { .pid = pid };
+
+        if (thread == NULL) {
+            continue;
+        }
+        if (thread_get_name(thread)) {
+            strncpy(entry.name, thread_get_name(thread), sizeof(entry.name));
+        }
+        write(&entry, sizeof(entry), arg);
+        threads++;
+    }
+    for (; threads < hdr.threads; threads++) {
+        trace_export_thread_t entry = { .pid = KERNEL_PID_UNDEF };
+
+        write(&entry, sizeof(entry), arg);
+    }
+
+    /* the entries may wrap around the end of the buffer */
+    unsigned start = first & (CONFIG_TRACE_BUFSIZE - 1);
+    unsigned n = hdr.entries;
+
+    if (start + n > CONFIG_TRACE_BUFSIZE) {
+        write(&tracebuf[start], (CONFIG_TRACE_BUFSIZE - start) *
+              sizeof(trace_entry_t), arg);
+        n -= CONFIG_TRACE_BUFSIZE - start;
+        start = 0;
+    }
+    write(&tracebuf[start], n * sizeof(trace_entry_t), arg);
+    tracebuf_enabled = enabled;
+}
+
+typedef struct {
+    uint8_t line[32];
+    unsigned len;
+} _stdio_ctx_t;
+
+static void _print_line(_stdio_ctx_t *ctx)
+{
+    printf("trace: ");
+    for (unsigned i = 0; i < ctx->len; i++) {
+        printf("%02x", ctx->line[i]);
+    }
+    puts("");
+    ctx->len = 0;
+}
+
+static void _write_stdio(const void *data, size_t len, void *arg)
+{
+    _stdio_ctx_t *ctx = arg;
+    const uint8_t *bytes = data;
+
+    while (len--) {
+        ctx->line[ctx->len++] = *bytes++;
+        if (ctx->len == sizeof(ctx->line)) {
+            _print_line(ctx);
+        }
+    }
+}
+
+void trace_export_stdio(void)
+{
+    _stdio_ctx_t ctx = { .len = 0 };
+
+    puts("trace: begin");
+    trace_export(_write_stdio, &ctx);
+    if (ctx.len) {
+        _print_line(&ctx);
+    }
+    puts("trace: end");
+}
+
+#ifdef CPU_NATIVE
+static void _write_file(const void *data, size_t len, void *arg)
+{
+    int *fd = arg;
+
+    if ((*fd >= 0) && (real_write(*fd, data, len) != (ssize_t)len)) {
+        real_close(*fd);
+        *fd = -errno;
+    }
+}
+
+int trace_export_file(const char *path)
+{
+    int fd = real_open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        return -errno;
+    }
+    trace_export(_write_file, &fd);
+    if (fd < 0) {
+        return fd;
+    }
+    return (real_close(fd) < 0) ? -errno : 0;
+}
+#endif
+
 void trace_reset(void)
 {
-    unsigned state = irq_disable();
+    atomic_store_explicit(&tracebuf_pos, 0, memory_order_relaxed);
+}
+
+#if IS_USED(MODULE_TRACE_SCHED)
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+    /* there is only one scheduler callback */
+    if (IS_USED(MODULE_SCHEDSTATISTICS)) {
+        sched_statistics_cb(active, next);
+    }
+    _record(TRACE_EV_THREAD_SWITCH, active, next);
+}
+#endif
 
-    tracebuf_pos = 0;
-    irq_restore(state);
+void auto_init_trace(void)
+{
+    tracebuf_enabled = true;
+#if IS_USED(MODULE_TRACE_SCHED)
+    sched_register_cb(_sched_cb);
+#endif
 }
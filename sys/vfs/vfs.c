@@ -75,6 +75,16 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+#if IS_USED(MODULE_VFS_BUFFERED)
+/**
+ * @internal
+ * @brief Buffers of the open files, NULL for unbuffered files
+ *
+ * Indexed the same way as _vfs_open_files
+ */
+static vfs_file_buffer_t *_vfs_file_buffers[VFS_MAX_OPEN_FILES];
+#endif
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -145,6 +155,32 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Get the buffer of a file
+ *
+ * @param[in]  fd    valid fd number
+ *
+ * @return pointer to the buffer of @p fd
+ * @return NULL if @p fd is not buffered
+ */
+static inline vfs_file_buffer_t *_fbuf(int fd);
+
+/**
+ * @internal
+ * @brief Write out pending data and give back unread data of a file buffer
+ *
+ * Afterwards, the position of the file driver matches the position seen by
+ * the user and the buffer is empty.
+ *
+ * @param[in]  filp  open file
+ * @param[in]  fbuf  buffer of @p filp, may be NULL
+ *
+ * @return 0 on success
+ * @return <0 on error
+ */
+static int _fbuf_sync(vfs_file_t *filp, vfs_file_buffer_t *fbuf);
+
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
@@ -156,10 +192,18 @@ int vfs_close(int fd)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+    vfs_file_buffer_t *fbuf = _fbuf(fd);
+    if ((fbuf != NULL) && fbuf->dirty) {
+        /* pending writes are dropped if they fail, the fd is closed anyway */
+        res = _fbuf_sync(filp, fbuf);
+    }
     if (filp->f_op->close != NULL) {
         /* We will invalidate the fd regardless of the outcome of the file
          * system driver close() call below */
-        res = filp->f_op->close(filp);
+        int close_res = filp->f_op->close(filp);
+        if (res == 0) {
+            res = close_res;
+        }
     }
     _free_fd(fd);
     return res;
@@ -205,6 +249,11 @@ int vfs_fstat(int fd, struct stat *buf)
         /* driver does not implement fstat() */
         return -EINVAL;
     }
+    /* the file size must include buffered writes */
+    res = _fbuf_sync(filp, _fbuf(fd));
+    if (res < 0) {
+        return res;
+    }
     memset(buf, 0, sizeof(*buf));
     return filp->f_op->fstat(filp, buf);
 }
@@ -242,14 +291,8 @@ int vfs_dstatvfs(vfs_DIR *dirp, struct statvfs *buf)
     return dirp->mp->fs->fs_op->statvfs(dirp->mp, "/", buf);
 }
 
-off_t vfs_lseek(int fd, off_t off, int whence)
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
 {
-    DEBUG("vfs_lseek: %d, %ld, %d\n", fd, (long)off, whence);
-    int res = _fd_is_valid(fd);
-    if (res < 0) {
-        return res;
-    }
-    vfs_file_t *filp = &_vfs_open_files[fd];
     if (filp->f_op->lseek == NULL) {
         /* driver does not implement lseek() */
         /* default seek functionality is naive */
@@ -277,6 +320,21 @@ off_t vfs_lseek(int fd, off_t off, int whence)
     return filp->f_op->lseek(filp, off, whence);
 }
 
+off_t vfs_lseek(int fd, off_t off, int whence)
+{
+    DEBUG("vfs_lseek: %d, %ld, %d\n", fd, (long)off, whence);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    res = _fbuf_sync(filp, _fbuf(fd));
+    if (res < 0) {
+        return res;
+    }
+    return _lseek(filp, off, whence);
+}
+
 int vfs_open(const char *name, int flags, mode_t mode)
 {
     DEBUG("vfs_open: \"%s\", 0x%x, 0%03lo\n", name, flags, (long unsigned int)mode);
@@ -317,6 +375,53 @@ int vfs_open(const char *name, int flags, mode_t mode)
     return fd;
 }
 
+static ssize_t _read(vfs_file_t *filp, vfs_file_buffer_t *fbuf, void *dest,
+                     size_t count)
+{
+    if (!IS_USED(MODULE_VFS_BUFFERED) || (fbuf == NULL)) {
+        return filp->f_op->read(filp, dest, count);
+    }
+
+    if (fbuf->dirty) {
+        int res = _fbuf_sync(filp, fbuf);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    size_t done = MIN(count, fbuf->len - fbuf->pos);
+    memcpy(dest, &fbuf->data[fbuf->pos], done);
+    fbuf->pos += done;
+    count -= done;
+    if (count == 0) {
+        return done;
+    }
+
+    /* buffer is empty, at most one call to the driver from here on */
+    ssize_t res;
+    if (count >= fbuf->size) {
+        res = filp->f_op->read(filp, (uint8_t *)dest + done, count);
+    }
+    else {
+        res = filp->f_op->read(filp, fbuf->data, fbuf->size);
+        if (res > 0) {
+            fbuf->len = res;
+            fbuf->pos = MIN(count, (size_t)res);
+            memcpy((uint8_t *)dest + done, fbuf->data, fbuf->pos);
+            res = fbuf->pos;
+        }
+        else {
+            fbuf->len = 0;
+            fbuf->pos = 0;
+        }
+    }
+
+    if (res < 0) {
+        return done ? (ssize_t)done : res;
+    }
+    return done + res;
+}
+
 static inline int _prep_read(int fd, const void *dest, vfs_file_t **filp)
 {
     if (dest == NULL) {
@@ -353,7 +458,7 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
         return res;
     }
 
-    return filp->f_op->read(filp, dest, count);
+    return _read(filp, _fbuf(fd), dest, count);
 }
 
 ssize_t vfs_readline(int fd, char *dst, size_t len_max)
@@ -367,9 +472,10 @@ ssize_t vfs_readline(int fd, char *dst, size_t len_max)
         return res;
     }
 
+    vfs_file_buffer_t *fbuf = _fbuf(fd);
     const char *start = dst;
     while (len_max) {
-        int res = filp->f_op->read(filp, dst, 1);
+        int res = _read(filp, fbuf, dst, 1);
         if (res < 0) {
             break;
         }
@@ -410,7 +516,25 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
-    return filp->f_op->write(filp, src, count);
+
+    vfs_file_buffer_t *fbuf = _fbuf(fd);
+    if (!IS_USED(MODULE_VFS_BUFFERED) || (fbuf == NULL)) {
+        return filp->f_op->write(filp, src, count);
+    }
+
+    if (!fbuf->dirty || (fbuf->len + count > fbuf->size)) {
+        res = _fbuf_sync(filp, fbuf);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (count >= fbuf->size) {
+        return filp->f_op->write(filp, src, count);
+    }
+    memcpy(&fbuf->data[fbuf->len], src, count);
+    fbuf->len += count;
+    fbuf->dirty = true;
+    return count;
 }
 
 ssize_t vfs_write_iol(int fd, const iolist_t *snips)
@@ -441,6 +565,10 @@ int vfs_fsync(int fd)
         /* File not open for writing */
         return -EBADF;
     }
+    res = _fbuf_sync(filp, _fbuf(fd));
+    if (res < 0) {
+        return res;
+    }
     if (filp->f_op->fsync == NULL) {
         /* driver does not implement fsync() */
         return -EINVAL;
@@ -448,6 +576,33 @@ int vfs_fsync(int fd)
     return filp->f_op->fsync(filp);
 }
 
+#if IS_USED(MODULE_VFS_BUFFERED)
+int vfs_setvbuf(int fd, vfs_file_buffer_t *fbuf, void *buf, size_t size)
+{
+    DEBUG("vfs_setvbuf: %d, %p, %" PRIuSIZE "\n", fd, buf, size);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    res = _fbuf_sync(filp, _fbuf(fd));
+    if (res < 0) {
+        return res;
+    }
+    if ((fbuf == NULL) || (buf == NULL) || (size == 0)) {
+        _vfs_file_buffers[fd] = NULL;
+        return 0;
+    }
+    fbuf->data = buf;
+    fbuf->size = size;
+    fbuf->len = 0;
+    fbuf->pos = 0;
+    fbuf->dirty = false;
+    _vfs_file_buffers[fd] = fbuf;
+    return 0;
+}
+#endif
+
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("vfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
@@ -1117,6 +1272,9 @@ static inline void _free_fd(int fd)
         assume(before > 0);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+#if IS_USED(MODULE_VFS_BUFFERED)
+    _vfs_file_buffers[fd] = NULL;
+#endif
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1212,6 +1370,50 @@ static inline int _fd_is_valid(int fd)
     return 0;
 }
 
+static inline vfs_file_buffer_t *_fbuf(int fd)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    return _vfs_file_buffers[fd];
+#else
+    (void)fd;
+    return NULL;
+#endif
+}
+
+static int _fbuf_sync(vfs_file_t *filp, vfs_file_buffer_t *fbuf)
+{
+    if (!IS_USED(MODULE_VFS_BUFFERED) || (fbuf == NULL)) {
+        return 0;
+    }
+
+    if (fbuf->dirty) {
+        size_t done = 0;
+        while (done < fbuf->len) {
+            ssize_t res = filp->f_op->write(filp, &fbuf->data[done],
+                                            fbuf->len - done);
+            if (res <= 0) {
+                /* keep what was not written for the next attempt */
+                memmove(fbuf->data, &fbuf->data[done], fbuf->len - done);
+                fbuf->len -= done;
+                return res < 0 ? res : -EIO;
+            }
+            done += res;
+        }
+        fbuf->dirty = false;
+    }
+    else if (fbuf->pos < fbuf->len) {
+        /* give back the data that was read ahead */
+        off_t res = _lseek(filp, -(off_t)(fbuf->len - fbuf->pos), SEEK_CUR);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    fbuf->len = 0;
+    fbuf->pos = 0;
+    return 0;
+}
+
 static bool _is_dir(vfs_mount_t *mountp, vfs_DIR *dir, const char *restrict path)
 {
     const vfs_dir_ops_t *ops = mountp->fs->d_op;
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       evtimer benchmark with many pending events
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "container.h"
+#include "evtimer.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef EVENTS
+#define EVENTS      (2000U)
+#endif
+
+#ifndef MAX_OFFSET
+#define MAX_OFFSET  (500U)
+#endif
+
+/* offsets of the events that are removed again before they expire */
+#define MIN_OFFSET_LONG (60U * MS_PER_SEC)
+#define MAX_OFFSET_LONG (600U * MS_PER_SEC)
+
+/* offset of a single event, spanning many revolutions of the timing wheel */
+#define IDLE_OFFSET     (MS_PER_SEC)
+
+typedef struct {
+    evtimer_event_t event;
+    uint32_t due;       /**< expiry time in ms */
+    uint32_t fired;     /**< time of the callback in ms, 0 if not fired */
+} bench_event_t;
+
+static evtimer_t _evtimer;
+static bench_event_t _events[EVENTS];
+static volatile unsigned _fired;
+static uint32_t _seed = 1;
+static ztimer_callback_t _handler;
+static unsigned _wakeups;
+
+static uint32_t _rand(void)
+{
+    /* deterministic, so every run sees the same offsets */
+    _seed = _seed * 1103515245U + 12345U;
+    return _seed >> 16;
+}
+
+static void _callback(evtimer_event_t *event)
+{
+    bench_event_t *ev = container_of(event, bench_event_t, event);
+
+    ev->fired = ztimer_now(ZTIMER_MSEC);
+    _fired++;
+}
+
+static void _count_wakeup(void *arg)
+{
+    _wakeups++;
+    _handler(arg);
+}
+
+/* returns the events in a different order than they were added in */
+static bench_event_t *_event(unsigned i)
+{
+    /* EVENTS / 2 + 1 is co-prime to EVENTS for even EVENTS */
+    return &_events[(i * (EVENTS / 2 + 1)) % EVENTS];
+}
+
+static int _add_del(void)
+{
+    uint32_t start, add, del;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _events[i].event.offset = MIN_OFFSET_LONG +
+                                  _rand() % (MAX_OFFSET_LONG - MIN_OFFSET_LONG);
+        evtimer_add(&_evtimer, &_events[i].event);
+    }
+    add = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < EVENTS; i++) {
+        evtimer_del(&_evtimer, &_event(i)->event);
+    }
+    del = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("add: %u events in %" PRIu32 " us (%" PRIu32 " us per event)\n",
+           EVENTS, add, add / EVENTS);
+    printf("del: %u events in %" PRIu32 " us (%" PRIu32 " us per event)\n",
+           EVENTS, del, del / EVENTS);
+
+    if (evtimer_find(&_evtimer, NULL, NULL, NULL) || _fired) {
+        puts("events left after removing all of them");
+        return -1;
+    }
+    return 0;
+}
+
+static int _expiry(void)
+{
+    unsigned expected = 0;
+    uint32_t late = 0;
+
+    for (unsigned i = 0; i < EVENTS; i++) {
+        bench_event_t *ev = _event(i);
+        /* the events removed again must not expire before that */
+        ev->event.offset = (i % 4) ? 1 + _rand() % MAX_OFFSET
+                                   : MAX_OFFSET / 2 + _rand() % (MAX_OFFSET / 2);
+        ev->fired = 0;
+        ev->due = ztimer_now(ZTIMER_MSEC) + ev->event.offset;
+        evtimer_add(&_evtimer, &ev->event);
+    }
+    for (unsigned i = 0; i < EVENTS; i++) {
+        bench_event_t *ev = _event(i);
+        if (i % 4) {
+            expected++;
+        }
+        else {
+            evtimer_del(&_evtimer, &ev->event);
+            if (evtimer_is_set(&_evtimer, &ev->event)) {
+                puts("event still set after removing it");
+                return -1;
+            }
+        }
+    }
+
+    ztimer_sleep(ZTIMER_MSEC, 2 * MAX_OFFSET);
+
+    for (unsigned i = 0; i < EVENTS; i++) {
+        bench_event_t *ev = _event(i);
+        if (!(i % 4)) {
+            if (ev->fired) {
+                puts("removed event expired");
+                return -1;
+            }
+            continue;
+        }
+        if (!ev->fired || ((int32_t)(ev->fired - ev->due) < 0)) {
+            printf("event expired at %" PRIu32 " ms, due at %" PRIu32 " ms\n",
+                   ev->fired, ev->due);
+            return -1;
+        }
+        if (ev->fired - ev->due > late) {
+            late = ev->fired - ev->due;
+        }
+    }
+
+    printf("expiry: %u events, max %" PRIu32 " ms late\n", expected, late);
+    return (_fired == expected) ? 0 : -1;
+}
+
+static int _idle(void)
+{
+    bench_event_t *ev = &_events[0];
+
+    /* start right after a tick, so the event is due within the same tick */
+    ztimer_sleep(ZTIMER_MSEC, 1);
+    ev->event.offset = 0;
+    ev->fired = 0;
+    ev->due = ztimer_now(ZTIMER_MSEC);
+    evtimer_add(&_evtimer, &ev->event);
+    while (!ev->fired && (ztimer_now(ZTIMER_MSEC) - ev->due < 10)) {}
+    printf("offset 0: expired after %" PRIu32 " ms\n", ev->fired - ev->due);
+    if (ev->fired != ev->due) {
+        return -1;
+    }
+
+    _wakeups = 0;
+    ev->event.offset = IDLE_OFFSET;
+    ev->fired = 0;
+    ev->due = ztimer_now(ZTIMER_MSEC) + IDLE_OFFSET;
+    evtimer_add(&_evtimer, &ev->event);
+    ztimer_sleep(ZTIMER_MSEC, 2 * IDLE_OFFSET);
+    printf("idle: 1 event in %u ms, %u timer wakeups\n",
+           (unsigned)IDLE_OFFSET, _wakeups);
+    if (!ev->fired || ((int32_t)(ev->fired - ev->due) < 0)) {
+        printf("event expired at %" PRIu32 " ms, due at %" PRIu32 " ms\n",
+               ev->fired, ev->due);
+        return -1;
+    }
+    return (_wakeups == 1) ? 0 : -1;
+}
+
+int main(void)
+{
+    evtimer_init(&_evtimer, _callback);
+    /* count how often the event timer wakes up */
+    _handler = _evtimer.timer.callback;
+    _evtimer.timer.callback = _count_wakeup;
+
+    printf("%u events\n", EVENTS);
+
+    if (_add_del() || _expiry() || _idle()) {
+        puts("FAILURE");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
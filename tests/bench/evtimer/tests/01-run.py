@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"add: \d+ events in \d+ us")
+    child.expect(r"del: \d+ events in \d+ us")
+    child.expect(r"expiry: \d+ events, max \d+ ms late")
+    child.expect_exact("offset 0: expired after 0 ms")
+    child.expect(r"idle: 1 event in \d+ ms, 1 timer wakeups")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       IPv6 forwarding benchmark between two Ethernet interfaces
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "ztimer.h"
+
+#ifndef PACKETS
+#define PACKETS     (10000U)
+#endif
+
+#define HOP_LIMIT       (64U)
+#define DST_PFX_LEN     (64U)
+#define TIMEOUT_MS      (100U)
+
+enum {
+    NETIF_IN,
+    NETIF_OUT,
+    NETIF_NUMOF,
+};
+
+static const uint8_t _macs[NETIF_NUMOF][ETHERNET_ADDR_LEN] = {
+    { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 },
+    { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x27 },
+};
+/* the host sending the packets, on the link of NETIF_IN */
+static const uint8_t _src_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x01 };
+/* the routers to the destination, on the link of NETIF_OUT */
+static const uint8_t _nbr_macs[][ETHERNET_ADDR_LEN] = {
+    { 0x57, 0x44, 0x33, 0x22, 0x11, 0x02 },
+    { 0x57, 0x44, 0x33, 0x22, 0x11, 0x03 },
+};
+static const ipv6_addr_t _nbrs[] = {
+    { .u8 = { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x02 } },
+    { .u8 = { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x03 } },
+};
+static const ipv6_addr_t _src = {
+    .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01,
+            0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x01 }
+};
+static const ipv6_addr_t _dst = {
+    .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd,
+            0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00 }
+};
+
+static netdev_test_t _devs[NETIF_NUMOF];
+static gnrc_netif_t _netifs[NETIF_NUMOF];
+static char _netif_stacks[NETIF_NUMOF][THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _forwarded = MUTEX_INIT_LOCKED;
+static uint8_t _fwd_mac[ETHERNET_ADDR_LEN];
+static uint8_t _fwd_hl;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    netdev_test_t *test = container_of(container_of(dev, netdev_ieee802154_t,
+                                                    netdev),
+                                       netdev_test_t, netdev);
+
+    (void)max_len;
+    memcpy(value, _macs[(intptr_t)test->state], ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t)];
+    const ethernet_hdr_t *eth = (ethernet_hdr_t *)frame;
+    const ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&frame[sizeof(ethernet_hdr_t)];
+    size_t len = iolist_size(iolist);
+    size_t copied = 0;
+
+    (void)dev;
+    for (; iolist && (copied < sizeof(frame)); iolist = iolist->iol_next) {
+        size_t chunk = iolist->iol_len;
+
+        if (chunk > sizeof(frame) - copied) {
+            chunk = sizeof(frame) - copied;
+        }
+        memcpy(&frame[copied], iolist->iol_base, chunk);
+        copied += chunk;
+    }
+    /* ignore anything but the forwarded packets, e.g. router advertisements */
+    if ((copied == sizeof(frame)) && ipv6_addr_equal(&ipv6->dst, &_dst)) {
+        memcpy(_fwd_mac, eth->dst, sizeof(_fwd_mac));
+        _fwd_hl = ipv6->hl;
+        mutex_unlock(&_forwarded);
+    }
+    return len;
+}
+
+static int _setup(void)
+{
+    for (intptr_t i = 0; i < NETIF_NUMOF; i++) {
+        netdev_test_setup(&_devs[i], (void *)i);
+        netdev_test_set_get_cb(&_devs[i], NETOPT_DEVICE_TYPE,
+                               _get_device_type);
+        netdev_test_set_get_cb(&_devs[i], NETOPT_MAX_PDU_SIZE,
+                               _get_max_pdu_size);
+        netdev_test_set_get_cb(&_devs[i], NETOPT_ADDRESS, _get_address);
+        netdev_test_set_send_cb(&_devs[i], _send);
+        if (gnrc_netif_ethernet_create(&_netifs[i], _netif_stacks[i],
+                                       sizeof(_netif_stacks[i]),
+                                       GNRC_NETIF_PRIO, "netdev_test",
+                                       &_devs[i].netdev.netdev)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _route(unsigned nbr)
+{
+    if (gnrc_ipv6_nib_nc_set(&_nbrs[nbr], _netifs[NETIF_OUT].pid,
+                             _nbr_macs[nbr], ETHERNET_ADDR_LEN) < 0) {
+        return -1;
+    }
+    return gnrc_ipv6_nib_ft_add(&_dst, DST_PFX_LEN, &_nbrs[nbr],
+                                _netifs[NETIF_OUT].pid, 0);
+}
+
+/* hands a packet to IPv6 as if it was received on NETIF_IN */
+static int _receive(void)
+{
+    uint8_t payload[16] = { 0 };
+    gnrc_pktsnip_t *netif_hdr, *pkt;
+    ipv6_hdr_t *hdr;
+
+    netif_hdr = gnrc_netif_hdr_build(_src_mac, sizeof(_src_mac),
+                                     _macs[NETIF_IN], ETHERNET_ADDR_LEN);
+    if (netif_hdr == NULL) {
+        return -1;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netifs[NETIF_IN]);
+    pkt = gnrc_pktbuf_add(netif_hdr, NULL, sizeof(ipv6_hdr_t) + sizeof(payload),
+                          GNRC_NETTYPE_IPV6);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif_hdr);
+        return -1;
+    }
+    hdr = pkt->data;
+    hdr->v_tc_fl = byteorder_htonl(0x60000000);
+    hdr->len = byteorder_htons(sizeof(payload));
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = HOP_LIMIT;
+    memcpy(&hdr->src, &_src, sizeof(hdr->src));
+    memcpy(&hdr->dst, &_dst, sizeof(hdr->dst));
+    memcpy(hdr + 1, payload, sizeof(payload));
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    return 0;
+}
+
+/* checks that a packet gets forwarded to neighbor @p nbr */
+static int _forward(unsigned nbr)
+{
+    if ((_receive() < 0) ||
+        (ztimer_mutex_lock_timeout(ZTIMER_MSEC, &_forwarded, TIMEOUT_MS) < 0)) {
+        return -1;
+    }
+    if ((memcmp(_fwd_mac, _nbr_macs[nbr], ETHERNET_ADDR_LEN) != 0) ||
+        (_fwd_hl != HOP_LIMIT - 1)) {
+        puts("packet forwarded to wrong next hop");
+        return -1;
+    }
+    return 0;
+}
+
+static int _bench(void)
+{
+    uint32_t start, time;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PACKETS; i++) {
+        if (_forward(0) < 0) {
+            printf("packet %u not forwarded\n", i);
+            return -1;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("forwarded %u packets in %" PRIu32 " us (%" PRIu32 " packets/s)\n",
+           PACKETS, time, (uint32_t)((uint64_t)PACKETS * US_PER_SEC / time));
+    return 0;
+}
+
+/* cached next hops must not outlive changes of the route */
+static int _change_route(void)
+{
+    gnrc_ipv6_nib_ft_del(&_dst, DST_PFX_LEN);
+    if ((_receive() < 0) ||
+        (ztimer_mutex_lock_timeout(ZTIMER_MSEC, &_forwarded, TIMEOUT_MS) == 0)) {
+        puts("packet forwarded without route");
+        return -1;
+    }
+    if ((_route(1) < 0) || (_forward(1) < 0)) {
+        puts("packet not forwarded over new route");
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    if ((_setup() < 0) || (_route(0) < 0)) {
+        puts("setting up interfaces failed");
+        return 1;
+    }
+
+    if ((_bench() < 0) || (_change_route() < 0)) {
+        puts("FAILURE");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
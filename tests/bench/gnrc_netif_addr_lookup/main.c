@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       IPv6 address lookup benchmark for nodes with many addresses
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/netdev_test.h"
+#include "ztimer.h"
+
+#ifndef NETIFS
+#define NETIFS      (4U)
+#endif
+
+#ifndef LOOKUPS
+#define LOOKUPS     (10000U)
+#endif
+
+#define TEST_NETIF_PRIO     (THREAD_PRIORITY_MAIN - 4)
+
+static netdev_test_t _netdevs[NETIFS];
+static gnrc_netif_t _netifs[NETIFS];
+static char _netif_stacks[NETIFS][THREAD_STACKSIZE_DEFAULT];
+
+/* 2001:db8:<netif>:<i>::<netif>:<i> */
+static void _addr(ipv6_addr_t *addr, unsigned netif, unsigned i)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[2] = byteorder_htons(netif);
+    addr->u16[3] = byteorder_htons(i);
+    addr->u16[6] = byteorder_htons(netif);
+    addr->u16[7] = byteorder_htons(i + 1);
+}
+
+/* ff15::<netif> */
+static void _group(ipv6_addr_t *addr, unsigned netif)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->u16[0] = byteorder_htons(0xff15);
+    addr->u16[7] = byteorder_htons(netif + 1);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_TEST;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IPV6_MIN_MTU;
+    return sizeof(uint16_t);
+}
+
+static int _setup(void)
+{
+    for (unsigned n = 0; n < NETIFS; n++) {
+        ipv6_addr_t addr;
+
+        netdev_test_setup(&_netdevs[n], NULL);
+        netdev_test_set_get_cb(&_netdevs[n], NETOPT_DEVICE_TYPE,
+                               _get_device_type);
+        netdev_test_set_get_cb(&_netdevs[n], NETOPT_MAX_PDU_SIZE,
+                               _get_max_pdu_size);
+        if (gnrc_netif_raw_create(&_netifs[n], _netif_stacks[n],
+                                  sizeof(_netif_stacks[n]), TEST_NETIF_PRIO,
+                                  "netdev_test", &_netdevs[n].netdev.netdev)) {
+            return -1;
+        }
+        /* leave room for the link-local address, if any */
+        for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF - 1; i++) {
+            _addr(&addr, n, i);
+            if (gnrc_netif_ipv6_addr_add(&_netifs[n], &addr, 64,
+                                         GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) {
+                return -1;
+            }
+        }
+        _group(&addr, n);
+        if (gnrc_netif_ipv6_group_join(&_netifs[n], &addr) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t _lookup(const char *name, const ipv6_addr_t *addr,
+                        const gnrc_netif_t *expected)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < LOOKUPS; i++) {
+        if (gnrc_netif_get_by_ipv6_addr(addr) != expected) {
+            printf("%s: unexpected interface\n", name);
+            return UINT32_MAX;
+        }
+    }
+
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    printf("%s: %u lookups in %" PRIu32 " us\n", name, LOOKUPS, time);
+    return time;
+}
+
+int main(void)
+{
+    /* interfaces are iterated in reverse order of creation, so a linear
+     * search visits this one last */
+    gnrc_netif_t *last = &_netifs[0];
+    ipv6_addr_t addr;
+    uint32_t start, time;
+    int idx;
+
+    if (_setup()) {
+        puts("setting up interfaces failed");
+        return 1;
+    }
+
+    printf("%u interfaces with %u addresses and %u groups each\n", NETIFS,
+           CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF, GNRC_NETIF_IPV6_GROUPS_NUMOF);
+
+    /* a packet received for the last address of the last interface */
+    _addr(&addr, 0, CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF - 2);
+    if (_lookup("local unicast", &addr, last) == UINT32_MAX) {
+        goto fail;
+    }
+    /* a packet received for a multicast group of the last interface */
+    _group(&addr, 0);
+    if (_lookup("multicast", &addr, last) == UINT32_MAX) {
+        goto fail;
+    }
+    /* a packet to be forwarded */
+    _addr(&addr, NETIFS, 0);
+    if (_lookup("not local", &addr, NULL) == UINT32_MAX) {
+        goto fail;
+    }
+
+    /* the source address check when sending */
+    _addr(&addr, 0, CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF - 2);
+    idx = gnrc_netif_ipv6_addr_idx(last, &addr);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < LOOKUPS; i++) {
+        if ((idx < 0) || (gnrc_netif_ipv6_addr_idx(last, &addr) != idx)) {
+            puts("address index: unexpected index");
+            goto fail;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("address index: %u lookups in %" PRIu32 " us\n", LOOKUPS, time);
+
+    /* removed addresses must not be found anymore */
+    _addr(&addr, 0, 0);
+    gnrc_netif_ipv6_addr_remove(&_netifs[0], &addr);
+    if (gnrc_netif_get_by_ipv6_addr(&addr) != NULL) {
+        puts("removed address still found");
+        goto fail;
+    }
+
+    puts("SUCCESS");
+    return 0;
+
+fail:
+    puts("FAILURE");
+    return 1;
+}
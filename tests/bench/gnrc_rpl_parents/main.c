@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       RPL parent set maintenance benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/icmpv6.h"
+#include "net/netdev_test.h"
+#include "utlist.h"
+#include "ztimer.h"
+
+#ifndef NEIGHBORS
+#define NEIGHBORS       (32U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (100U)
+#endif
+
+/* every NEIGHBORS_DEEP-th neighbor is one hop further away from the root */
+#define NEIGHBORS_DEEP  (4U)
+
+#define MIN_HOP_RANK_INC    CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE
+
+#define TEST_NETIF_PRIO     (THREAD_PRIORITY_MAIN - 4)
+
+typedef struct __attribute__((packed)) {
+    icmpv6_hdr_t hdr;
+    gnrc_rpl_dio_t dio;
+    gnrc_rpl_opt_dodag_conf_t conf;
+} dio_msg_t;
+
+static netdev_test_t _netdev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static const ipv6_addr_t _dodag_id = {{ 0x20, 0x01, 0x0d, 0xb8,
+                                        0x00, 0x00, 0x00, 0x00,
+                                        0x00, 0x00, 0x00, 0x00,
+                                        0x00, 0x00, 0x00, 0x01 }};
+static const ipv6_addr_t _addr = {{ 0x20, 0x01, 0x0d, 0xb8,
+                                    0x00, 0x00, 0x00, 0x00,
+                                    0x00, 0x00, 0x00, 0x00,
+                                    0x00, 0x00, 0x00, 0x02 }};
+
+static uint16_t _ranks[NEIGHBORS];
+static uint32_t _seed = 1;
+
+static uint32_t _rand(void)
+{
+    /* deterministic, so every run sees the same topology */
+    _seed = _seed * 1103515245U + 12345U;
+    return _seed >> 16;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    const uint16_t type = NETDEV_TYPE_SLIP;
+    memcpy(value, &type, sizeof(type));
+    return sizeof(uint16_t);
+}
+
+static void _neighbor_addr(ipv6_addr_t *addr, unsigned n)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    memset(&addr->u8[8], 0, 8);
+    addr->u16[7] = byteorder_htons(n + 1);
+}
+
+static uint16_t _neighbor_rank(unsigned n)
+{
+    unsigned hops = (n % NEIGHBORS_DEEP) ? 1 : 2;
+
+    /* the link metric changes, but stays within the DAGRank */
+    return hops * MIN_HOP_RANK_INC + (_rand() % MIN_HOP_RANK_INC);
+}
+
+static int _send_dio(unsigned n)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *icmpv6;
+    ipv6_hdr_t *ipv6_hdr;
+    dio_msg_t *msg;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif == NULL) {
+        return -1;
+    }
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+
+    ipv6 = gnrc_pktbuf_add(netif, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    icmpv6 = gnrc_pktbuf_add(ipv6, NULL, sizeof(dio_msg_t), GNRC_NETTYPE_ICMPV6);
+    if ((ipv6 == NULL) || (icmpv6 == NULL)) {
+        gnrc_pktbuf_release(netif);
+        return -1;
+    }
+
+    ipv6_hdr = ipv6->data;
+    ipv6_hdr_set_version(ipv6_hdr);
+    ipv6_hdr->len = byteorder_htons(sizeof(dio_msg_t));
+    ipv6_hdr->nh = PROTNUM_ICMPV6;
+    ipv6_hdr->hl = 255;
+    _neighbor_addr(&ipv6_hdr->src, n);
+    ipv6_hdr->dst = ipv6_addr_all_rpl_nodes;
+
+    msg = icmpv6->data;
+    memset(msg, 0, sizeof(*msg));
+    msg->hdr.type = ICMPV6_RPL_CTRL;
+    msg->hdr.code = GNRC_RPL_ICMPV6_CODE_DIO;
+    msg->dio.instance_id = CONFIG_GNRC_RPL_DEFAULT_INSTANCE;
+    msg->dio.version_number = GNRC_RPL_COUNTER_INIT;
+    msg->dio.rank = byteorder_htons(_ranks[n]);
+    /* grounded, no downward routes, so no DAOs are sent */
+    msg->dio.g_mop_prf = (1 << 7) | (GNRC_RPL_MOP_NO_DOWNWARD_ROUTES << 3);
+    msg->dio.dodag_id = _dodag_id;
+    msg->conf.type = GNRC_RPL_OPT_DODAG_CONF;
+    msg->conf.length = sizeof(gnrc_rpl_opt_dodag_conf_t) - sizeof(gnrc_rpl_opt_t);
+    msg->conf.dio_int_doubl = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_DOUBLINGS;
+    msg->conf.dio_int_min = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_MIN;
+    msg->conf.dio_redun = CONFIG_GNRC_RPL_DEFAULT_DIO_REDUNDANCY_CONSTANT;
+    msg->conf.max_rank_inc = byteorder_htons(CONFIG_GNRC_RPL_DEFAULT_MAX_RANK_INCREASE);
+    msg->conf.min_hop_rank_inc = byteorder_htons(MIN_HOP_RANK_INC);
+    msg->conf.ocp = byteorder_htons(GNRC_RPL_DEFAULT_OCP);
+    msg->conf.default_lifetime = CONFIG_GNRC_RPL_DEFAULT_LIFETIME;
+    msg->conf.lifetime_unit = byteorder_htons(CONFIG_GNRC_RPL_LIFETIME_UNIT);
+
+    /* the RPL thread has a higher priority, so the DIO is processed before
+     * this returns */
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_ICMPV6, ICMPV6_RPL_CTRL,
+                                      icmpv6)) {
+        gnrc_pktbuf_release(icmpv6);
+        return -1;
+    }
+    return 0;
+}
+
+static int _check(gnrc_rpl_dodag_t *dodag)
+{
+    uint16_t best = GNRC_RPL_INFINITE_RANK;
+    unsigned expected = 0;
+    unsigned count = 0;
+    gnrc_rpl_parent_t *elt;
+
+    for (unsigned n = 0; n < NEIGHBORS; n++) {
+        if (n % NEIGHBORS_DEEP) {
+            expected++;
+            if (_ranks[n] < best) {
+                best = _ranks[n];
+            }
+        }
+    }
+
+    LL_FOREACH(dodag->parents, elt) {
+        if (elt->next && (elt->rank > elt->next->rank)) {
+            puts("parent list not ordered");
+            return -1;
+        }
+        count++;
+    }
+
+    if ((dodag->parents == NULL) || (dodag->parents->rank != best) ||
+        (dodag->my_rank != best + MIN_HOP_RANK_INC)) {
+        printf("unexpected rank %u, expected %u\n", dodag->my_rank,
+               best + MIN_HOP_RANK_INC);
+        return -1;
+    }
+    if (count != expected) {
+        printf("%u parents, expected %u\n", count, expected);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    gnrc_rpl_instance_t *inst;
+    gnrc_rpl_parent_t *preferred = NULL;
+    unsigned changes = 0;
+    uint32_t start, join, update = 0;
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                          TEST_NETIF_PRIO, "netdev_test",
+                          &_netdev.netdev.netdev);
+    gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                             GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID);
+    gnrc_rpl_init(_netif.pid);
+
+    printf("%u neighbors, %u rounds\n", NEIGHBORS, ROUNDS);
+
+    /* all neighbors show up, deeper ones are not selected as parents */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < NEIGHBORS; n++) {
+        _ranks[n] = _neighbor_rank(n);
+        if (_send_dio(n)) {
+            puts("sending DIO failed");
+            return 1;
+        }
+    }
+    join = ztimer_now(ZTIMER_USEC) - start;
+
+    inst = gnrc_rpl_instance_get(CONFIG_GNRC_RPL_DEFAULT_INSTANCE);
+    if ((inst == NULL) || _check(&inst->dodag)) {
+        puts("FAILURE");
+        return 1;
+    }
+
+    /* periodic DIOs with changing link metrics */
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        for (unsigned n = 0; n < NEIGHBORS; n++) {
+            _ranks[n] = _neighbor_rank(n);
+            start = ztimer_now(ZTIMER_USEC);
+            if (_send_dio(n)) {
+                puts("sending DIO failed");
+                return 1;
+            }
+            update += ztimer_now(ZTIMER_USEC) - start;
+            if (inst->dodag.parents != preferred) {
+                preferred = inst->dodag.parents;
+                changes++;
+            }
+        }
+        if (_check(&inst->dodag)) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    printf("join: %u DIOs in %" PRIu32 " us\n", NEIGHBORS, join);
+    printf("update: %u DIOs in %" PRIu32 " us (%" PRIu32 " us per DIO)\n",
+           NEIGHBORS * ROUNDS, update, update / (NEIGHBORS * ROUNDS));
+    printf("preferred parent changes: %u\n", changes);
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Stress test of concurrent allocations with malloc_thread_safe
+ *
+ * Several time-sliced worker threads allocate and free small blocks of
+ * varying sizes, while a high priority thread periodically allocates and
+ * measures how long it has to wait for the heap.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+#include "malloc_thread_safe.h"
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (20000U)
+#endif
+
+#define WORKERS         (3U)
+/* blocks held by a worker at the same time */
+#define SLOTS           (8U)
+#define MAX_SIZE        (128U)
+#define URGENT_PERIOD   (1000U)
+
+#define FLAG_DONE       (1U << 0)
+
+static char _stacks[WORKERS][THREAD_STACKSIZE_DEFAULT];
+static char _urgent_stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_main;
+static volatile bool _running = true;
+static unsigned _failed;
+static uint32_t _urgent_max, _urgent_total, _urgent_count;
+
+static void *_worker(void *arg)
+{
+    uint32_t seed = (uintptr_t)arg;
+    void *slots[SLOTS] = { NULL };
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        unsigned slot = i % SLOTS;
+
+        /* cheap LCG, a PRNG module would dominate the measurement */
+        seed = seed * 1103515245U + 12345U;
+        size_t size = 1 + (seed >> 16) % MAX_SIZE;
+
+        free(slots[slot]);
+        slots[slot] = malloc(size);
+        if (slots[slot] == NULL) {
+            _failed++;
+            continue;
+        }
+        memset(slots[slot], slot, size);
+        /* let a block grow now and then */
+        if ((seed & 0x7) == 0) {
+            void *grown = realloc(slots[slot], size * 2);
+            if (grown == NULL) {
+                _failed++;
+                continue;
+            }
+            slots[slot] = grown;
+        }
+    }
+    for (unsigned slot = 0; slot < SLOTS; slot++) {
+        free(slots[slot]);
+    }
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    malloc_thread_safe_cache_flush();
+#endif
+    thread_flags_set(_main, FLAG_DONE);
+    return NULL;
+}
+
+static void *_urgent(void *arg)
+{
+    (void)arg;
+
+    while (_running) {
+        ztimer_sleep(ZTIMER_USEC, URGENT_PERIOD);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        void *ptr = malloc(32);
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        free(ptr);
+        _urgent_total += time;
+        _urgent_count++;
+        if (time > _urgent_max) {
+            _urgent_max = time;
+        }
+    }
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    malloc_thread_safe_cache_flush();
+#endif
+    return NULL;
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+
+    thread_create(_urgent_stack, sizeof(_urgent_stack),
+                  THREAD_PRIORITY_MAIN - 2, 0, _urgent, NULL, "urgent");
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < WORKERS; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      0, _worker, (void *)(uintptr_t)(i + 1), "worker");
+    }
+    for (unsigned i = 0; i < WORKERS; i++) {
+        thread_flags_wait_any(FLAG_DONE);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    _running = false;
+
+    printf("%u workers: %u rounds in %" PRIu32 " us, %" PRIu32
+           " ns per round\n", WORKERS, WORKERS * ROUNDS, time,
+           (uint32_t)((uint64_t)time * 1000 / (WORKERS * ROUNDS)));
+    printf("urgent malloc(): %" PRIu32 " us on average, %" PRIu32
+           " us at most\n", _urgent_count ? _urgent_total / _urgent_count : 0,
+           _urgent_max);
+
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE_CACHE)
+    malloc_thread_safe_cache_stats_t stats;
+
+    malloc_thread_safe_cache_stats(&stats);
+    printf("cache: locked %" PRIu32 " times, %" PRIu32 " fallbacks\n",
+           stats.locked, stats.fallbacks);
+#endif
+    if (_failed) {
+        printf("%u allocations failed\n", _failed);
+        puts("FAILURE");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
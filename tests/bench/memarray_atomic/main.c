@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares a memarray guarded by irq_disable() with the
+ *              lock-free memarray under contention by an interrupt
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "memarray.h"
+#include "memarray_atomic.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (100000U)
+#endif
+
+#define BLOCK_SIZE      (32U)
+#define BLOCKS          (32U)
+/* blocks allocated at once in the batch benchmark */
+#define BATCH           (8U)
+/* blocks the interrupt holds on to */
+#define ISR_BLOCKS      (4U)
+#define ISR_PERIOD_US   (50U)
+
+static uint8_t _data[BLOCKS][BLOCK_SIZE];
+static uint8_t _adata[BLOCKS][BLOCK_SIZE];
+static memarray_t _mem;
+static memarray_atomic_t _amem;
+
+static ztimer_t _timer;
+static void *_isr_blocks[ISR_BLOCKS];
+static unsigned _isr_next;
+static uint32_t _isr_runs;
+static bool _use_atomic;
+static unsigned _failed;
+
+static void _isr(void *arg)
+{
+    (void)arg;
+    void **slot = &_isr_blocks[_isr_next++ % ISR_BLOCKS];
+
+    if (_use_atomic) {
+        if (*slot) {
+            memarray_atomic_free(&_amem, *slot);
+        }
+        *slot = memarray_atomic_alloc(&_amem);
+    }
+    else {
+        /* runs in interrupt context, no need to disable them */
+        if (*slot) {
+            memarray_free(&_mem, *slot);
+        }
+        *slot = memarray_alloc(&_mem);
+    }
+    if (*slot == NULL) {
+        _failed++;
+    }
+    _isr_runs++;
+    ztimer_set(ZTIMER_USEC, &_timer, ISR_PERIOD_US);
+}
+
+static void _isr_start(bool atomic)
+{
+    _use_atomic = atomic;
+    _isr_runs = 0;
+    _timer.callback = _isr;
+    ztimer_set(ZTIMER_USEC, &_timer, ISR_PERIOD_US);
+}
+
+static void _isr_stop(void)
+{
+    ztimer_remove(ZTIMER_USEC, &_timer);
+    for (unsigned i = 0; i < ISR_BLOCKS; i++) {
+        if (_isr_blocks[i] == NULL) {
+            continue;
+        }
+        if (_use_atomic) {
+            memarray_atomic_free(&_amem, _isr_blocks[i]);
+        }
+        else {
+            memarray_free(&_mem, _isr_blocks[i]);
+        }
+        _isr_blocks[i] = NULL;
+    }
+}
+
+static void _print(const char *name, uint32_t time, unsigned blocks)
+{
+    printf("%-24s %5" PRIu32 " ns per block, %6" PRIu32 " interrupts\n", name,
+           (uint32_t)((uint64_t)time * 1000 / blocks), _isr_runs);
+}
+
+static void _bench_irq_disable(void)
+{
+    _isr_start(false);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        unsigned state = irq_disable();
+        void *block = memarray_alloc(&_mem);
+        irq_restore(state);
+
+        if (block == NULL) {
+            _failed++;
+            continue;
+        }
+        memset(block, i, BLOCK_SIZE);
+
+        state = irq_disable();
+        memarray_free(&_mem, block);
+        irq_restore(state);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    _isr_stop();
+    _print("irq_disable():", time, ROUNDS);
+}
+
+static void _bench_irq_disable_batch(void)
+{
+    void *blocks[BATCH];
+
+    _isr_start(false);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS / BATCH; i++) {
+        unsigned state = irq_disable();
+        size_t num = memarray_alloc_n(&_mem, blocks, BATCH);
+        irq_restore(state);
+
+        if (num == 0) {
+            _failed++;
+            continue;
+        }
+        memset(blocks[0], i, BLOCK_SIZE);
+
+        state = irq_disable();
+        memarray_free_n(&_mem, blocks, BATCH);
+        irq_restore(state);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    _isr_stop();
+    _print("irq_disable() batch:", time, ROUNDS / BATCH * BATCH);
+}
+
+static void _bench_atomic(void)
+{
+    _isr_start(true);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        void *block = memarray_atomic_alloc(&_amem);
+
+        if (block == NULL) {
+            _failed++;
+            continue;
+        }
+        memset(block, i, BLOCK_SIZE);
+        memarray_atomic_free(&_amem, block);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    _isr_stop();
+    _print("memarray_atomic:", time, ROUNDS);
+}
+
+static void _bench_atomic_batch(void)
+{
+    void *blocks[BATCH];
+
+    _isr_start(true);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS / BATCH; i++) {
+        if (memarray_atomic_alloc_n(&_amem, blocks, BATCH) == 0) {
+            _failed++;
+            continue;
+        }
+        memset(blocks[0], i, BLOCK_SIZE);
+        memarray_atomic_free_n(&_amem, blocks, BATCH);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    _isr_stop();
+    _print("memarray_atomic batch:", time, ROUNDS / BATCH * BATCH);
+}
+
+int main(void)
+{
+    void *blocks[BLOCKS];
+
+    memarray_init(&_mem, _data, BLOCK_SIZE, BLOCKS);
+    memarray_atomic_init(&_amem, _adata, BLOCK_SIZE, BLOCKS);
+
+    _bench_irq_disable();
+    _bench_irq_disable_batch();
+    _bench_atomic();
+    _bench_atomic_batch();
+
+    printf("high-water mark: %" PRIuSIZE " of %u blocks\n",
+           memarray_atomic_high_water(&_amem), BLOCKS);
+
+    /* all blocks must have made it back to the pools */
+    if (_failed || (memarray_available(&_mem) != BLOCKS) ||
+        (memarray_atomic_available(&_amem) != BLOCKS) ||
+        (memarray_atomic_alloc_n(&_amem, blocks, BLOCKS) != BLOCKS)) {
+        puts("FAILURE");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
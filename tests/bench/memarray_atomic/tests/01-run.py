@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import re
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for name in ("irq_disable():", "irq_disable() batch:",
+                 "memarray_atomic:", "memarray_atomic batch:"):
+        child.expect(r"{}\s+\d+ ns per block,\s+\d+ interrupts"
+                     .format(re.escape(name)))
+    child.expect(r"high-water mark: (\d+) of (\d+) blocks")
+    assert 0 < int(child.match.group(1)) <= int(child.match.group(2))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
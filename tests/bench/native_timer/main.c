@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Native timer wakeup latency benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "native_timer.h"
+#include "periph/timer.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef SLEEPS
+#define SLEEPS      (2000U)
+#endif
+
+#ifndef MAX_SLEEP
+#define MAX_SLEEP   (2000U)
+#endif
+
+/* number of timer_set() calls with an offset of 0 */
+#define ZERO_SETS   (100U)
+
+static uint32_t _seed = 1;
+
+static uint32_t _rand(void)
+{
+    /* deterministic, so every run sleeps the same */
+    _seed = _seed * 1103515245U + 12345U;
+    return _seed >> 16;
+}
+
+static void _zero_cb(void *arg, int chan)
+{
+    (void)chan;
+    thread_flags_set(arg, 1);
+}
+
+/* timer_set() with an offset of 0 has to fire right away, the timer is
+ * taken over from ztimer for that, so this has to run last */
+static unsigned _zero_offset(void)
+{
+    unsigned fired = 0;
+
+    timer_init(TIMER_DEV(0), 1000000LU, _zero_cb, thread_get_active());
+    for (unsigned i = 0; i < ZERO_SETS; i++) {
+        unsigned start = timer_read(TIMER_DEV(0));
+        thread_flags_t flags;
+
+        timer_set(TIMER_DEV(0), 0, 0);
+        /* give up after 100 ms */
+        while (!(flags = thread_flags_clear(1)) &&
+               (timer_read(TIMER_DEV(0)) - start < 100000U)) {}
+        if (flags) {
+            fired++;
+        }
+    }
+    timer_stop(TIMER_DEV(0));
+
+    return fired;
+}
+
+int main(void)
+{
+    uint64_t sum = 0;
+    uint32_t max = 0;
+    unsigned early = 0;
+
+    printf("%u sleeps of up to %u us\n", SLEEPS, MAX_SLEEP);
+
+    /* let the timer settle */
+    ztimer_sleep(ZTIMER_USEC, 1000);
+    native_timer_latency_reset();
+
+    for (unsigned i = 0; i < SLEEPS; i++) {
+        uint32_t duration = 1 + _rand() % MAX_SLEEP;
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        ztimer_sleep(ZTIMER_USEC, duration);
+
+        int32_t late = ztimer_now(ZTIMER_USEC) - start - duration;
+        if (late < 0) {
+            early++;
+            continue;
+        }
+        sum += late;
+        if ((uint32_t)late > max) {
+            max = late;
+        }
+    }
+
+    printf("sleep: avg %" PRIu32 " us, max %" PRIu32 " us late, %u early\n",
+           (uint32_t)(sum / SLEEPS), max, early);
+    native_timer_latency_print();
+
+    unsigned fired = _zero_offset();
+    printf("zero offset: %u of %u fired\n", fired, ZERO_SETS);
+
+    puts((early || (fired != ZERO_SETS)) ? "FAILURE" : "SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"sleep: avg \d+ us, max \d+ us late, \d+ early")
+    child.expect(r"timer latency: \d+ IRQs, avg \d+ us, max \d+ us")
+    child.expect(r"zero offset: (\d+) of (\d+) fired")
+    assert child.match.group(1) == child.match.group(2)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
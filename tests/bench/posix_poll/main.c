@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares select(), poll() and epoll_wait() on UDP sockets
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef SOCKETS
+#define SOCKETS     (8U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS      (2000U)
+#endif
+
+#define PORT        (5683U)
+#define TIMEOUT_MS  (100U)
+
+static int _socks[SOCKETS];
+static int _sender;
+static int _epfd;
+
+static int _setup(void)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6,
+                                 .sin6_addr = IN6ADDR_LOOPBACK_INIT };
+    struct epoll_event event = { .events = EPOLLIN };
+
+    if ((_epfd = epoll_create1(0)) < 0) {
+        return -1;
+    }
+    for (unsigned i = 0; i < SOCKETS; i++) {
+        addr.sin6_port = htons(PORT + i);
+        _socks[i] = socket(AF_INET6, SOCK_DGRAM, 0);
+        if ((_socks[i] < 0) ||
+            (bind(_socks[i], (struct sockaddr *)&addr, sizeof(addr)) < 0)) {
+            return -1;
+        }
+        event.data.u32 = i;
+        if (epoll_ctl(_epfd, EPOLL_CTL_ADD, _socks[i], &event) < 0) {
+            return -1;
+        }
+    }
+    _sender = socket(AF_INET6, SOCK_DGRAM, 0);
+    return _sender;
+}
+
+static int _send(unsigned idx)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6,
+                                 .sin6_addr = IN6ADDR_LOOPBACK_INIT,
+                                 .sin6_port = htons(PORT + idx) };
+    uint8_t data = idx;
+
+    return sendto(_sender, &data, sizeof(data), 0, (struct sockaddr *)&addr,
+                  sizeof(addr));
+}
+
+static int _recv(unsigned idx)
+{
+    uint8_t data;
+
+    if ((recv(_socks[idx], &data, sizeof(data), 0) != sizeof(data)) ||
+        (data != (uint8_t)idx)) {
+        printf("wrong datagram on socket %u\n", idx);
+        return -1;
+    }
+    return 0;
+}
+
+/* all of the following return the index of the only ready socket */
+
+static int _wait_select(void)
+{
+    struct timeval timeout = { .tv_usec = TIMEOUT_MS * US_PER_MS };
+    fd_set readfds;
+    int ready = -1;
+
+    FD_ZERO(&readfds);
+    for (unsigned i = 0; i < SOCKETS; i++) {
+        FD_SET(_socks[i], &readfds);
+    }
+    if (select(_socks[SOCKETS - 1] + 1, &readfds, NULL, NULL, &timeout) != 1) {
+        return -1;
+    }
+    for (unsigned i = 0; i < SOCKETS; i++) {
+        if (FD_ISSET(_socks[i], &readfds)) {
+            ready = i;
+        }
+    }
+    return ready;
+}
+
+static int _wait_poll(void)
+{
+    struct pollfd fds[SOCKETS];
+    int ready = -1;
+
+    for (unsigned i = 0; i < SOCKETS; i++) {
+        fds[i].fd = _socks[i];
+        fds[i].events = POLLIN;
+    }
+    if (poll(fds, SOCKETS, TIMEOUT_MS) != 1) {
+        return -1;
+    }
+    for (unsigned i = 0; i < SOCKETS; i++) {
+        if (fds[i].revents == POLLIN) {
+            ready = i;
+        }
+    }
+    return ready;
+}
+
+static int _wait_epoll(void)
+{
+    struct epoll_event event;
+
+    if ((epoll_wait(_epfd, &event, 1, TIMEOUT_MS) != 1) ||
+        (event.events != EPOLLIN)) {
+        return -1;
+    }
+    return event.data.u32;
+}
+
+static int _bench(const char *name, int (*wait)(void))
+{
+    uint32_t start, time;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        unsigned idx = i % SOCKETS;
+
+        if (_send(idx) < 0) {
+            printf("%s: sending failed\n", name);
+            return -1;
+        }
+        if (wait() != (int)idx) {
+            printf("%s: socket %u not ready\n", name, idx);
+            return -1;
+        }
+        if (_recv(idx) < 0) {
+            return -1;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("%s: %u rounds on %u sockets in %" PRIu32 " us (%" PRIu32
+           " ns/round)\n", name, ROUNDS, SOCKETS, time,
+           (uint32_t)((uint64_t)time * NS_PER_US / ROUNDS));
+    return 0;
+}
+
+/* all methods must time out without data */
+static int _timeouts(void)
+{
+    struct pollfd fds = { .fd = _socks[0], .events = POLLIN };
+    struct epoll_event event;
+
+    if ((poll(&fds, 1, 1) != 0) || (fds.revents != 0)) {
+        puts("poll() did not time out");
+        return -1;
+    }
+    if (epoll_wait(_epfd, &event, 1, 1) != 0) {
+        puts("epoll_wait() did not time out");
+        return -1;
+    }
+    /* sockets are always writable, but only if asked for */
+    fds.events = POLLOUT;
+    if ((poll(&fds, 1, 0) != 1) || (fds.revents != POLLOUT)) {
+        puts("poll() did not report socket as writable");
+        return -1;
+    }
+    return 0;
+}
+
+/* with EPOLLET, a socket is only reported when it receives data */
+static int _edge_triggered(void)
+{
+    struct epoll_event event = { .events = EPOLLIN | EPOLLET };
+
+    if ((epoll_ctl(_epfd, EPOLL_CTL_MOD, _socks[0], &event) < 0) ||
+        (_send(0) < 0) || (epoll_wait(_epfd, &event, 1, TIMEOUT_MS) != 1) ||
+        (epoll_wait(_epfd, &event, 1, 0) != 0)) {
+        puts("EPOLLET socket not reported exactly once");
+        return -1;
+    }
+    if (_recv(0) < 0) {
+        return -1;
+    }
+    /* socket must not be reported anymore after it was removed */
+    if ((epoll_ctl(_epfd, EPOLL_CTL_DEL, _socks[0], NULL) < 0) ||
+        (_send(0) < 0) || (epoll_wait(_epfd, &event, 1, TIMEOUT_MS) != 0)) {
+        puts("removed socket reported");
+        return -1;
+    }
+    return _recv(0);
+}
+
+/* a closed socket is removed from the epoll instance, even if its file
+ * descriptor is reused right away */
+static int _close_reuse(void)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6,
+                                 .sin6_addr = IN6ADDR_LOOPBACK_INIT,
+                                 .sin6_port = htons(PORT + 1) };
+    struct epoll_event event = { .events = EPOLLIN, .data.u32 = 1 };
+    struct pollfd fds = { .events = POLLIN };
+
+    /* close the socket while it is reported as ready */
+    if ((_send(1) < 0) || (_wait_epoll() != 1)) {
+        puts("epoll: socket 1 not ready");
+        return -1;
+    }
+    close(_socks[1]);
+    _socks[1] = socket(AF_INET6, SOCK_DGRAM, 0);
+    if ((_socks[1] < 0) ||
+        (bind(_socks[1], (struct sockaddr *)&addr, sizeof(addr)) < 0)) {
+        return -1;
+    }
+    /* the socket only starts to receive once it is waited for */
+    fds.fd = _socks[1];
+    if (poll(&fds, 1, 1) != 0) {
+        return -1;
+    }
+    if ((_send(1) < 0) || (epoll_wait(_epfd, &event, 1, TIMEOUT_MS) != 0)) {
+        puts("socket reported after its file descriptor was closed");
+        return -1;
+    }
+    if ((poll(&fds, 1, TIMEOUT_MS) != 1) || (_recv(1) < 0)) {
+        return -1;
+    }
+    if (epoll_ctl(_epfd, EPOLL_CTL_ADD, _socks[1], &event) < 0) {
+        printf("adding reused file descriptor failed: %s\n", strerror(errno));
+        return -1;
+    }
+    if ((_send(1) < 0) || (_wait_epoll() != 1)) {
+        puts("new socket not reported");
+        return -1;
+    }
+    return _recv(1);
+}
+
+int main(void)
+{
+    if (_setup() < 0) {
+        printf("setting up sockets failed: %s\n", strerror(errno));
+        return 1;
+    }
+    if ((_bench("select", _wait_select) < 0) ||
+        (_bench("poll", _wait_poll) < 0) ||
+        (_bench("epoll", _wait_epoll) < 0) ||
+        (_timeouts() < 0) || (_edge_triggered() < 0) ||
+        (_close_reuse() < 0)) {
+        puts("FAILURE");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Rate of PSA Crypto operations with many keys loaded
+ *
+ * Every operation has to look up its key among all keys in RAM, this
+ * benchmark measures how many operations per second can be done on keys
+ * picked at random.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "psa/crypto.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef KEYS
+#define KEYS            (32U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (100000U)
+#endif
+
+#define MSG_LEN         (32U)
+#define HMAC_ALG        PSA_ALG_HMAC(PSA_ALG_SHA_256)
+#define HMAC_LEN        PSA_MAC_LENGTH(PSA_KEY_TYPE_HMAC, 256, HMAC_ALG)
+#define CIPHER_ALG      PSA_ALG_CBC_NO_PADDING
+#define CIPHER_LEN      PSA_CIPHER_ENCRYPT_OUTPUT_SIZE(PSA_KEY_TYPE_AES, CIPHER_ALG, \
+                                                       MSG_LEN)
+
+static psa_key_id_t _hmac_keys[KEYS];
+static psa_key_id_t _aes_keys[KEYS];
+static uint8_t _msg[MSG_LEN];
+static uint32_t _seed = 1;
+
+static unsigned _pick(void)
+{
+    /* cheap LCG, a PRNG module would dominate the measurement */
+    _seed = _seed * 1103515245U + 12345U;
+    return (_seed >> 16) % KEYS;
+}
+
+static int _import(psa_key_type_t type, psa_algorithm_t alg, psa_key_usage_t usage,
+                   size_t bytes, psa_key_id_t *ids)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+    uint8_t key[32];
+
+    psa_set_key_algorithm(&attr, alg);
+    psa_set_key_usage_flags(&attr, usage);
+    psa_set_key_bits(&attr, PSA_BYTES_TO_BITS(bytes));
+    psa_set_key_type(&attr, type);
+
+    for (unsigned i = 0; i < KEYS; i++) {
+        memset(key, i, bytes);
+        if (psa_import_key(&attr, key, bytes, &ids[i]) != PSA_SUCCESS) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%s: %" PRIu32 " calls/s, %" PRIu32 " ns per call\n", name,
+           (uint32_t)((uint64_t)ROUNDS * US_PER_SEC / time),
+           (uint32_t)((uint64_t)time * 1000 / ROUNDS));
+}
+
+int main(void)
+{
+    uint8_t out[CIPHER_LEN > HMAC_LEN ? CIPHER_LEN : HMAC_LEN];
+    size_t out_len;
+    unsigned failed = 0;
+
+    if ((psa_crypto_init() != PSA_SUCCESS) ||
+        _import(PSA_KEY_TYPE_HMAC, HMAC_ALG, PSA_KEY_USAGE_SIGN_MESSAGE, 32,
+                _hmac_keys) ||
+        _import(PSA_KEY_TYPE_AES, CIPHER_ALG, PSA_KEY_USAGE_ENCRYPT, 16,
+                _aes_keys)) {
+        puts("FAILURE: key import");
+        return 1;
+    }
+    printf("%u keys loaded\n", 2 * KEYS);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        psa_key_attributes_t attr = psa_key_attributes_init();
+
+        failed += psa_get_key_attributes(_aes_keys[_pick()], &attr) != PSA_SUCCESS;
+    }
+    _print("psa_get_key_attributes()", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        failed += psa_mac_compute(_hmac_keys[_pick()], HMAC_ALG, _msg, sizeof(_msg),
+                                  out, sizeof(out), &out_len) != PSA_SUCCESS;
+    }
+    _print("psa_mac_compute()", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        failed += psa_cipher_encrypt(_aes_keys[_pick()], CIPHER_ALG, _msg, sizeof(_msg),
+                                     out, sizeof(out), &out_len) != PSA_SUCCESS;
+    }
+    _print("psa_cipher_encrypt()", ztimer_now(ZTIMER_USEC) - start);
+
+    if (failed) {
+        printf("FAILURE: %u operations failed\n", failed);
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of polling many devices through the SAUL registry
+ *
+ * A few dozen mock sensors are registered, then all of them are polled
+ * repeatedly, once looking every device up by type and name before reading
+ * it, and once reading the looked up devices with saul_reg_read_many().
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "saul_reg.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (2000U)
+#endif
+
+#define DEVICES         (48U)
+
+static const uint8_t _types[] = {
+    SAUL_SENSE_TEMP, SAUL_SENSE_HUM, SAUL_SENSE_PRESS, SAUL_SENSE_LIGHT,
+    SAUL_SENSE_ACCEL, SAUL_SENSE_CO2, SAUL_SENSE_DISTANCE, SAUL_SENSE_VOLTAGE,
+};
+
+#define TYPES           ARRAY_SIZE(_types)
+
+static int _mock_read(const void *dev, phydat_t *res)
+{
+    res->val[0] = (uintptr_t)dev;
+    res->unit = UNIT_NONE;
+    res->scale = 0;
+    return 1;
+}
+
+static saul_driver_t _drivers[TYPES];
+static saul_reg_t _entries[DEVICES];
+static char _names[DEVICES][12];
+static saul_reg_t *_devs[DEVICES];
+static phydat_t _res[DEVICES];
+static unsigned _failed;
+
+static void _register(void)
+{
+    for (unsigned i = 0; i < TYPES; i++) {
+        _drivers[i].read = _mock_read;
+        _drivers[i].write = saul_write_notsup;
+        _drivers[i].type = _types[i];
+    }
+    for (unsigned i = 0; i < DEVICES; i++) {
+        snprintf(_names[i], sizeof(_names[i]), "sensor%02u", i);
+        _entries[i].dev = (void *)(uintptr_t)i;
+        _entries[i].name = _names[i];
+        _entries[i].driver = &_drivers[i % TYPES];
+        saul_reg_add(&_entries[i]);
+    }
+}
+
+static void _check(unsigned i, int dim, const phydat_t *res)
+{
+    if ((dim != 1) || (res->val[0] != (int16_t)i)) {
+        _failed++;
+    }
+}
+
+int main(void)
+{
+    phydat_t res;
+    uint32_t start, time;
+
+    _register();
+    printf("%u devices, %u polls\n", DEVICES, ROUNDS);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        for (unsigned i = 0; i < DEVICES; i++) {
+            saul_reg_t *dev = saul_reg_find_type_and_name(_types[i % TYPES],
+                                                          _names[i]);
+            _check(i, saul_reg_read(dev, &res), &res);
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("find and read: %" PRIu32 " us, %" PRIu32 " ns per device\n", time,
+           (uint32_t)((uint64_t)time * 1000 / (ROUNDS * DEVICES)));
+
+    for (unsigned i = 0; i < DEVICES; i++) {
+        _devs[i] = saul_reg_find_type_and_name(_types[i % TYPES], _names[i]);
+    }
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        if (saul_reg_read_many(_devs, DEVICES, _res, NULL) != DEVICES) {
+            _failed++;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    for (unsigned i = 0; i < DEVICES; i++) {
+        _check(i, 1, &_res[i]);
+    }
+    printf("read_many: %" PRIu32 " us, %" PRIu32 " ns per device\n", time,
+           (uint32_t)((uint64_t)time * 1000 / (ROUNDS * DEVICES)));
+
+    /* a type no device has, the list has to be walked completely */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        if (saul_reg_find_type(SAUL_SENSE_UV) != NULL) {
+            _failed++;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("find_type: %" PRIu32 " ns per lookup\n",
+           (uint32_t)((uint64_t)time * 1000 / ROUNDS));
+
+    if (_failed) {
+        printf("%u lookups or reads failed\n", _failed);
+        puts("FAILURE");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
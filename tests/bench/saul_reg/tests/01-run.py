@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"\d+ devices, \d+ polls")
+    child.expect(r"find and read: \d+ us, \d+ ns per device")
+    child.expect(r"read_many: \d+ us, \d+ ns per device")
+    child.expect(r"find_type: \d+ ns per lookup")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the overhead of the scheduler statistics and lets a
+ *              thread be woken up periodically while another one is busy
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "shell.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef SWITCHES
+#define SWITCHES    (10000U)
+#endif
+
+#ifndef WAKEUPS
+#define WAKEUPS     (100U)
+#endif
+
+/* time between two wakeups of the periodic thread */
+#define PERIOD_US   (1000U)
+
+static char _echo_stack[THREAD_STACKSIZE_DEFAULT];
+static char _periodic_stack[THREAD_STACKSIZE_DEFAULT];
+static volatile unsigned _wakeups;
+
+static void *_echo(void *arg)
+{
+    thread_t *main_thread = arg;
+
+    while (1) {
+        thread_flags_wait_any(1);
+        thread_flags_set(main_thread, 1);
+    }
+    return NULL;
+}
+
+static void *_periodic(void *arg)
+{
+    (void)arg;
+    ztimer_t timer = { 0 };
+
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        ztimer_set_timeout_flag(ZTIMER_USEC, &timer, PERIOD_US);
+        thread_flags_wait_any(THREAD_FLAG_TIMEOUT);
+        _wakeups++;
+    }
+    /* stay around for the statistics */
+    thread_sleep();
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t start, time;
+
+    /* context switches forth and back between two threads */
+    thread_t *other = thread_get(
+        thread_create(_echo_stack, sizeof(_echo_stack),
+                      THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST, _echo, thread_get_active(),
+                      "echo"));
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < SWITCHES / 2; i++) {
+        thread_flags_set(other, 1);
+        thread_flags_wait_any(1);
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("%u context switches: %" PRIu32 " ns per switch\n", SWITCHES,
+           (uint32_t)((uint64_t)time * 1000 / SWITCHES));
+
+    /* stay busy while a thread of higher priority is woken up periodically */
+    thread_create(_periodic_stack, sizeof(_periodic_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST, _periodic,
+                  NULL, "periodic");
+    while (_wakeups < WAKEUPS) {}
+    printf("%u wakeups done\n", WAKEUPS);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import json
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"\d+ context switches: \d+ ns per switch")
+    child.expect(r"(\d+) wakeups done")
+    wakeups = int(child.match.group(1))
+
+    child.sendline("schedstat")
+    child.expect(r"(\{\"threads\": \[.*\]\})\r\n")
+    stats = json.loads(child.match.group(1))
+    threads = {thread["name"]: thread for thread in stats["threads"]}
+    # the periodic thread waited for its timer and was scheduled for each
+    # wakeup, preempting the busy main thread
+    assert threads["periodic"]["voluntary"] >= wakeups
+    assert sum(threads["periodic"]["latency"]) >= wakeups
+    assert threads["main"]["preempted"] >= wakeups
+    assert len(stats["irq_latency"]) == len(threads["main"]["latency"])
+    assert sum(stats["irq_latency"]) > 0
+
+    child.sendline("ps")
+    child.expect(r"\| preempted \| latency_max")
+    child.expect(r"IRQ latency: \d+ us at most")
+
+    child.sendline("schedstat reset")
+    child.sendline("schedstat")
+    child.expect(r"(\{\"threads\": \[.*\]\})\r\n")
+    stats = json.loads(child.match.group(1))
+    assert stats["irq_latency_max_us"] < 1000000
+    for thread in stats["threads"]:
+        assert thread["preempted"] < wakeups
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import threading
+import tty
+from testrunner import run
+
+
+def echo(fd):
+    """Write everything sent to the pty back to it"""
+    while True:
+        try:
+            data = os.read(fd, 4096)
+        except OSError:
+            return
+        if not data:
+            return
+        os.write(fd, data)
+
+
+def testfunc(child):
+    child.expect(r"\w+: \d+ frames of \d+ bytes in \d+ us, \d+ kbit/s")
+    child.expect(r"send\(\): \d+ us per frame")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    if os.environ.get("BOARD", "native") in ("native", "native32", "native64") \
+            and "LOOPBACK_TTY" not in os.environ:
+        master, slave = os.openpty()
+        tty.setraw(slave)
+        os.environ["LOOPBACK_TTY"] = os.ttyname(slave)
+        threading.Thread(target=echo, args=(master,), daemon=True).start()
+    sys.exit(run(testfunc, timeout=120))
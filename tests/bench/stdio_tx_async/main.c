@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures how long a thread is blocked by printing a log line
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ztimer.h"
+
+#if IS_USED(MODULE_STDIO_TX_ASYNC)
+#include "stdio_base.h"
+#include "stdio_tx_async.h"
+#endif
+
+#ifndef LINES
+#define LINES       (200U)
+#endif
+
+/* time between two log lines, a line takes 3.8 ms to transmit at 115200 Bd */
+#define PERIOD_US   (5000U)
+
+#if IS_USED(MODULE_STDIO_TX_ASYNC)
+/* output larger than the ring buffer, which must not be dropped either */
+static char _long_line[CONFIG_STDIO_TX_ASYNC_BUFSIZE + 64];
+#endif
+
+int main(void)
+{
+    uint32_t total = 0, max = 0;
+
+    for (unsigned i = 0; i < LINES; i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        printf("[%4u] packet forwarded to next hop fe80::1\n", i);
+
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        total += time;
+        if (time > max) {
+            max = time;
+        }
+        ztimer_sleep(ZTIMER_USEC, PERIOD_US);
+    }
+    printf("printed %u lines, %" PRIu32 " us on average, %" PRIu32
+           " us at most\n", LINES, total / LINES, max);
+
+#if IS_USED(MODULE_STDIO_TX_ASYNC)
+    stdio_tx_async_stats_t stats;
+
+    memset(_long_line, '-', sizeof(_long_line) - 1);
+    _long_line[sizeof(_long_line) - 1] = '\n';
+    stdio_write(_long_line, sizeof(_long_line));
+
+    stdio_tx_async_flush();
+    stdio_tx_async_stats(&stats);
+    printf("written: %" PRIu32 " bytes, dropped: %" PRIu32 " bytes in %"
+           PRIu32 " writes\n", stats.written, stats.dropped, stats.drops);
+    if (stats.dropped) {
+        puts("FAILURE");
+        return 1;
+    }
+#endif
+    puts("SUCCESS");
+
+    return 0;
+}
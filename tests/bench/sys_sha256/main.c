@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the SHA-256 implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "hashes/sha256.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_MSGS
+#define NUMOF_MSGS  (4)
+#endif
+
+#ifndef MSG_LEN
+#define MSG_LEN     (1024)
+#endif
+
+#ifndef REPEAT
+#define REPEAT      (256)
+#endif
+
+static uint8_t _msgs[NUMOF_MSGS][MSG_LEN];
+static uint8_t _digests[NUMOF_MSGS][SHA256_DIGEST_LENGTH];
+static uint8_t _reference[NUMOF_MSGS][SHA256_DIGEST_LENGTH];
+
+static void _print_result(const char *name, uint32_t usec)
+{
+    uint64_t bytes = (uint64_t)REPEAT * NUMOF_MSGS * MSG_LEN;
+
+    print_str(name);
+    print_u32_dec(usec);
+    print_str(" µs (");
+    print_u64_dec(usec ? (bytes * US_PER_SEC / 1024) / usec : 0);
+    print_str(" KiB/s)\n");
+}
+
+int main(void)
+{
+    const void *data[NUMOF_MSGS];
+    size_t len[NUMOF_MSGS];
+    void *digest[NUMOF_MSGS];
+    uint32_t start, stop;
+
+    for (unsigned i = 0; i < NUMOF_MSGS; i++) {
+        for (unsigned j = 0; j < MSG_LEN; j++) {
+            _msgs[i][j] = i + j * 7;
+        }
+        data[i] = _msgs[i];
+        len[i] = MSG_LEN;
+        digest[i] = _digests[i];
+    }
+
+    print_str("Hardware transform: ");
+    print_str(sha2xx_accel_available() ? "yes\n" : "no\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < REPEAT; r++) {
+        for (unsigned i = 0; i < NUMOF_MSGS; i++) {
+            sha256(_msgs[i], MSG_LEN, _reference[i]);
+        }
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+    _print_result("sha256():       ", stop - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < REPEAT; r++) {
+        sha256_multi(data, len, NUMOF_MSGS, digest);
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+    _print_result("sha256_multi(): ", stop - start);
+
+    print_str("Verifying that sha256_multi() matches sha256(): ");
+    print_str(memcmp(_digests, _reference, sizeof(_digests)) ? "FAIL\n" : "OK\n");
+
+    return 0;
+}
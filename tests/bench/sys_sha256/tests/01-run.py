@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"Hardware transform: (yes|no)\r\n")
+    child.expect(r"sha256\(\): +[0-9]+ µs \([0-9]+ KiB/s\)\r\n")
+    child.expect(r"sha256_multi\(\): +[0-9]+ µs \([0-9]+ KiB/s\)\r\n")
+    child.expect_exact("Verifying that sha256_multi() matches sha256(): OK\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
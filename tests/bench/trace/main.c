@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the overhead of tracing and exports a trace of two
+ *              threads exchanging messages
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "trace.h"
+#include "ztimer.h"
+
+#ifndef EVENTS
+#define EVENTS      (10000U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS      (20U)
+#endif
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _lock = MUTEX_INIT;
+
+static void *_echo(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    while (1) {
+        msg_receive(&msg);
+        mutex_lock(&_lock);
+        msg.content.value++;
+        mutex_unlock(&_lock);
+        msg_send(&msg, msg.sender_pid);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t start, time;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < EVENTS; i++) {
+        trace_event(TRACE_EV_APP, i);
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("trace_event(): %" PRIu32 " ns per event\n",
+           (uint32_t)((uint64_t)time * 1000 / EVENTS));
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0, _echo, NULL,
+                                     "echo");
+
+    trace_reset();
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        msg_t msg = { .type = 0x1234, .content.value = i };
+
+        /* make the echo thread wait for the mutex every other round */
+        if (i & 1) {
+            mutex_lock(&_lock);
+        }
+        msg_send(&msg, pid);
+        if (i & 1) {
+            mutex_unlock(&_lock);
+        }
+        msg_receive(&msg);
+        if (msg.content.value != i + 1) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    trace_export_stdio();
+#ifdef TRACE_FILE
+    if (trace_export_file(TRACE_FILE) < 0) {
+        puts("writing " TRACE_FILE " failed");
+    }
+#endif
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+from testrunner import run
+
+sys.path.append(os.path.join(os.path.dirname(__file__),
+                             "../../../../dist/tools/trace"))
+import trace_decode  # noqa: E402
+
+
+def testfunc(child):
+    child.expect(r"trace_event\(\): \d+ ns per event")
+    child.expect_exact("trace: begin")
+    export = bytearray()
+    while child.expect([r"trace: ([0-9a-f]+)\r\n", r"trace: end"]) == 0:
+        export += bytes.fromhex(child.match.group(1))
+    child.expect_exact("SUCCESS")
+
+    trace = trace_decode.Trace(bytes(export))
+    events = set(trace_decode.event_name(entry[1], {})
+                 for entry in trace.entries)
+    for event in ("switch", "msg_send", "msg_recv", "mutex_lock",
+                  "mutex_block", "mutex_unlock"):
+        assert event in events, "no {} event traced".format(event)
+    assert "echo" in trace.threads.values()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
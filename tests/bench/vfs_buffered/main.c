@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Buffered VFS file access benchmark
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mtd_emulated.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_LITTLEFS2)
+#include "fs/littlefs2_fs.h"
+#define FS_DRIVER   littlefs2_file_system
+#define FS_DESC_T   littlefs2_desc_t
+#define PAGE_SIZE   (256)
+#elif IS_USED(MODULE_FATFS_VFS)
+#include "fs/fatfs.h"
+#define FS_DRIVER   fatfs_file_system
+#define FS_DESC_T   fatfs_desc_t
+/* FatFs needs 512 byte sectors */
+#define PAGE_SIZE   (512)
+#endif
+
+#ifndef BUFSIZE
+#define BUFSIZE     (256U)
+#endif
+
+#ifndef LINES
+#define LINES       (1000U)
+#endif
+
+#define SECTOR_COUNT    (256)
+#define PAGE_PER_SECTOR (1)
+
+#define FILENAME    "/bench/log.txt"
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static FS_DESC_T _fs_desc = {
+    .dev = &mtd_emulated_dev0.base,
+};
+
+/* the file system driver, with read() and write() wrapped to count calls */
+static vfs_file_system_t _fs;
+static vfs_file_ops_t _f_op;
+
+static vfs_mount_t _mount = {
+    .fs = &_fs,
+    .mount_point = "/bench",
+    .private_data = &_fs_desc,
+};
+
+static unsigned _calls;
+static vfs_file_buffer_t _fbuf;
+static uint8_t _buf[BUFSIZE];
+
+static ssize_t _read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    _calls++;
+    return FS_DRIVER.f_op->read(filp, dest, nbytes);
+}
+
+static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    _calls++;
+    return FS_DRIVER.f_op->write(filp, src, nbytes);
+}
+
+static int _open(int flags, bool buffered)
+{
+    int fd = vfs_open(FILENAME, flags, 0);
+
+    if ((fd >= 0) && buffered) {
+        vfs_setvbuf(fd, &_fbuf, _buf, sizeof(_buf));
+    }
+    return fd;
+}
+
+static int _write_log(bool buffered)
+{
+    char line[48];
+    uint32_t start;
+    int fd;
+
+    fd = _open(O_CREAT | O_TRUNC | O_WRONLY, buffered);
+    if (fd < 0) {
+        return fd;
+    }
+
+    _calls = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < LINES; i++) {
+        int len = snprintf(line, sizeof(line), "%05u: sensor reading %u\n",
+                           i, (i * 7919) % 1000);
+        if (vfs_write(fd, line, len) != len) {
+            vfs_close(fd);
+            return -1;
+        }
+    }
+    if (vfs_close(fd) < 0) {
+        return -1;
+    }
+
+    printf("write %s: %u lines, %u driver calls, %" PRIu32 " us\n",
+           buffered ? "buffered" : "unbuffered", LINES, _calls,
+           ztimer_now(ZTIMER_USEC) - start);
+    return 0;
+}
+
+static int _read_log(bool buffered)
+{
+    char line[48];
+    unsigned lines = 0;
+    uint32_t start;
+    int fd;
+
+    fd = _open(O_RDONLY, buffered);
+    if (fd < 0) {
+        return fd;
+    }
+
+    _calls = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    while (vfs_readline(fd, line, sizeof(line)) > 1) {
+        unsigned n;
+        if ((sscanf(line, "%05u:", &n) != 1) || (n != lines)) {
+            printf("unexpected line \"%s\"\n", line);
+            vfs_close(fd);
+            return -1;
+        }
+        lines++;
+    }
+    vfs_close(fd);
+
+    printf("readline %s: %u lines, %u driver calls, %" PRIu32 " us\n",
+           buffered ? "buffered" : "unbuffered", lines, _calls,
+           ztimer_now(ZTIMER_USEC) - start);
+    return lines == LINES ? 0 : -1;
+}
+
+int main(void)
+{
+    memcpy(&_fs, &FS_DRIVER, sizeof(_fs));
+    _f_op = *FS_DRIVER.f_op;
+    _f_op.read = _read;
+    _f_op.write = _write;
+    _fs.f_op = &_f_op;
+
+    if ((vfs_format(&_mount) < 0) || (vfs_mount(&_mount) < 0)) {
+        puts("mounting file system failed");
+        return 1;
+    }
+
+    printf("buffer size: %u\n", (unsigned)sizeof(_buf));
+
+    for (unsigned i = 0; i < 2; i++) {
+        if ((_write_log(i) < 0) || (_read_log(i) < 0)) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    vfs_umount(&_mount, false);
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for mode in ("unbuffered", "buffered"):
+        child.expect(r"write {}: \d+ lines, \d+ driver calls, \d+ us".format(mode))
+        child.expect(r"readline {}: \d+ lines, \d+ driver calls, \d+ us".format(mode))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
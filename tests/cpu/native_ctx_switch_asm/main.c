@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests that native_ctx_switch_asm does not block host signals
+ *
+ * @}
+ */
+
+#include <signal.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "native_internal.h"
+#include "thread.h"
+#include "ztimer.h"
+
+static int _blocked(int sig)
+{
+    sigset_t mask;
+
+    sigprocmask(SIG_BLOCK, NULL, &mask);
+    return sigismember(&mask, sig);
+}
+
+int main(void)
+{
+    /* timer interrupts still have to be handled */
+    ztimer_sleep(ZTIMER_MSEC, 10);
+
+    unsigned state = irq_disable();
+    int disabled = _blocked(SIGTERM) || _blocked(SIGHUP);
+    irq_restore(state);
+    int enabled = _blocked(SIGTERM) || _blocked(SIGHUP);
+
+    printf("blocked with IRQs disabled: %d, enabled: %d\n", disabled, enabled);
+    puts((disabled || enabled) ? "FAILURE" : "SUCCESS");
+
+    /* the test script terminates the process with SIGTERM while idle */
+    printf("pid: %d\n", (int)_native_pid);
+    thread_sleep();
+
+    return 0;
+}
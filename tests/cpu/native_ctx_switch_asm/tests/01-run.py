@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import signal
+import sys
+
+import pexpect
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("SUCCESS")
+    child.expect(r"pid: (\d+)\r\n")
+    os.kill(int(child.match.group(1)), signal.SIGTERM)
+    child.expect(pexpect.EOF, timeout=5)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for the DTLS session management
+ *
+ * The sessions are never established on the network, the DTLS socks are
+ * only used as keys by the session management.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/dsm.h"
+#include "xtimer.h"
+
+#define SESSIONS    (CONFIG_DSM_PEER_MAX)
+
+static sock_dtls_t _sock;
+static sock_dtls_t _other_sock;
+static sock_dtls_session_t _sessions[SESSIONS + 1];
+
+static void _init_session(sock_dtls_session_t *session, unsigned i)
+{
+    sock_udp_ep_t ep = SOCK_IPV6_EP_ANY;
+
+    ep.addr.ipv6[15] = 1;
+    ep.port = 5684 + i;
+    memset(session, 0, sizeof(*session));
+    sock_dtls_session_set_udp_ep(session, &ep);
+}
+
+static bool _same(sock_dtls_session_t *a, sock_dtls_session_t *b)
+{
+    sock_udp_ep_t ep_a, ep_b;
+
+    sock_dtls_session_get_udp_ep(a, &ep_a);
+    sock_dtls_session_get_udp_ep(b, &ep_b);
+    return (ep_a.port == ep_b.port) &&
+           (memcmp(ep_a.addr.ipv6, ep_b.addr.ipv6, sizeof(ep_a.addr.ipv6)) == 0);
+}
+
+static void _establish(sock_dtls_t *sock, unsigned i)
+{
+    TEST_ASSERT_EQUAL_INT(SESSION_STATE_NONE,
+                          dsm_store(sock, &_sessions[i],
+                                    SESSION_STATE_HANDSHAKE, false));
+    TEST_ASSERT_EQUAL_INT(SESSION_STATE_HANDSHAKE,
+                          dsm_store(sock, &_sessions[i],
+                                    SESSION_STATE_ESTABLISHED, false));
+}
+
+/* waits until sessions used before are idle for at least @p sec seconds */
+static void _idle(unsigned sec)
+{
+    xtimer_usleep(sec * US_PER_SEC + US_PER_SEC / 10);
+}
+
+static void set_up(void)
+{
+    dsm_init();
+    for (unsigned i = 0; i < ARRAY_SIZE(_sessions); i++) {
+        _init_session(&_sessions[i], i);
+    }
+}
+
+static void tear_down(void)
+{
+    /* the sessions are kept in static memory by dsm */
+    for (unsigned i = 0; i < ARRAY_SIZE(_sessions); i++) {
+        dsm_remove(&_sock, &_sessions[i]);
+        dsm_remove(&_other_sock, &_sessions[i]);
+    }
+}
+
+static void test_dsm_store__no_space(void)
+{
+    for (unsigned i = 0; i < SESSIONS; i++) {
+        _establish(&_sock, i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, dsm_get_num_available_slots());
+    TEST_ASSERT_EQUAL_INT(NO_SPACE, dsm_store(&_sock, &_sessions[SESSIONS],
+                                              SESSION_STATE_HANDSHAKE, false));
+    dsm_remove(&_sock, &_sessions[0]);
+    TEST_ASSERT_EQUAL_INT(1, dsm_get_num_available_slots());
+}
+
+static void test_dsm_stats(void)
+{
+    dsm_stats_t before, after;
+
+    dsm_get_stats(&before);
+    _establish(&_sock, 0);
+    /* every record sent looks the session up again */
+    TEST_ASSERT_EQUAL_INT(SESSION_STATE_ESTABLISHED,
+                          dsm_store(&_sock, &_sessions[0],
+                                    SESSION_STATE_HANDSHAKE, true));
+    TEST_ASSERT_EQUAL_INT(SESSION_STATE_ESTABLISHED,
+                          dsm_store(&_sock, &_sessions[0],
+                                    SESSION_STATE_HANDSHAKE, true));
+    dsm_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(1, after.handshakes - before.handshakes);
+    TEST_ASSERT_EQUAL_INT(0, after.restored - before.restored);
+
+    dsm_count_restored();
+    dsm_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(1, after.restored - before.restored);
+    TEST_ASSERT_EQUAL_INT(0, after.evicted - before.evicted);
+}
+
+static void test_dsm_evict_idle_session__threshold(void)
+{
+    sock_dtls_session_t session;
+
+    _establish(&_sock, 0);
+    _establish(&_sock, 1);
+    /* a session of another sock is never evicted */
+    _establish(&_other_sock, 2);
+    TEST_ASSERT_EQUAL_INT(-1, dsm_evict_idle_session(&_sock, &session, 1));
+    _idle(1);
+    /* receiving on a session keeps it */
+    dsm_refresh(&_sock, &_sessions[0]);
+    TEST_ASSERT_EQUAL_INT(1, dsm_evict_idle_session(&_sock, &session, 1));
+    TEST_ASSERT(_same(&session, &_sessions[1]));
+    TEST_ASSERT_EQUAL_INT(1, dsm_get_num_available_slots());
+    TEST_ASSERT_EQUAL_INT(-1, dsm_evict_idle_session(&_sock, &session, 1));
+}
+
+static void test_dsm_evict_idle_session__lru(void)
+{
+    sock_dtls_session_t session;
+
+    _establish(&_sock, 0);
+    _establish(&_sock, 1);
+    _idle(1);
+    _establish(&_sock, 2);
+    _idle(1);
+    /* sending on a session keeps it */
+    TEST_ASSERT_EQUAL_INT(SESSION_STATE_ESTABLISHED,
+                          dsm_store(&_sock, &_sessions[0],
+                                    SESSION_STATE_HANDSHAKE, true));
+
+    /* both idle sessions qualify, the least recently used one goes first */
+    TEST_ASSERT_EQUAL_INT(1, dsm_evict_idle_session(&_sock, &session, 1));
+    TEST_ASSERT(_same(&session, &_sessions[1]));
+    TEST_ASSERT_EQUAL_INT(1, dsm_evict_idle_session(&_sock, &session, 1));
+    TEST_ASSERT(_same(&session, &_sessions[2]));
+    TEST_ASSERT_EQUAL_INT(-1, dsm_evict_idle_session(&_sock, &session, 1));
+}
+
+static void test_dsm_evict_idle_session__busy(void)
+{
+    dsm_stats_t before, after;
+    sock_dtls_session_t session;
+
+    dsm_get_stats(&before);
+    _establish(&_sock, 0);
+    _idle(1);
+    _establish(&_sock, 1);
+    /* a session in handshake is never evicted */
+    TEST_ASSERT_EQUAL_INT(SESSION_STATE_NONE,
+                          dsm_store(&_sock, &_sessions[2],
+                                    SESSION_STATE_HANDSHAKE, false));
+    TEST_ASSERT_EQUAL_INT(-1, dsm_evict_idle_session(&_sock, &session, 60));
+    /* without an idle threshold, the least recently used one goes */
+    TEST_ASSERT_EQUAL_INT(1, dsm_evict_idle_session(&_sock, &session, 0));
+    TEST_ASSERT(_same(&session, &_sessions[0]));
+    TEST_ASSERT_EQUAL_INT(1, dsm_evict_idle_session(&_sock, &session, 0));
+    TEST_ASSERT(_same(&session, &_sessions[1]));
+    TEST_ASSERT_EQUAL_INT(-1, dsm_evict_idle_session(&_sock, &session, 0));
+    dsm_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(2, after.evicted - before.evicted);
+}
+
+static Test *tests_dsm(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_dsm_store__no_space),
+        new_TestFixture(test_dsm_stats),
+        new_TestFixture(test_dsm_evict_idle_session__threshold),
+        new_TestFixture(test_dsm_evict_idle_session__lru),
+        new_TestFixture(test_dsm_evict_idle_session__busy),
+    };
+
+    EMB_UNIT_TESTCALLER(dsm_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&dsm_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_dsm());
+    TESTS_END();
+
+    return 0;
+}
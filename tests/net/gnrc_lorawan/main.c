@@ -101,6 +101,34 @@ static void test_gnrc_lorawan__wrong_mic(void)
     TEST_ASSERT(memcmp(&calc_mic, mic, sizeof(le_uint32_t)) != 0);
 }
 
+static void test_gnrc_lorawan__mic_key_change(void)
+{
+    iolist_t pkt = { .iol_base = lorawan_packet_no_mic,
+                     .iol_len = sizeof(lorawan_packet_no_mic),
+                     .iol_next = NULL };
+    uint8_t key[sizeof(nwkskey)];
+    le_uint32_t calc_mic;
+
+    gnrc_lorawan_t mac = { 0 };
+
+    memcpy(key, nwkskey, sizeof(key));
+    memcpy(&mac.dev_addr, &dev_addr, sizeof(dev_addr));
+    mac.ctx.fnwksintkey = key;
+    mac.mcps.fcnt = fcnt;
+
+    gnrc_lorawan_calculate_mic_uplink(&pkt, 0x00, &mac, &calc_mic);
+    TEST_ASSERT(memcmp(&calc_mic, mic, sizeof(le_uint32_t)) == 0);
+
+    /* the key is changed in place, e.g. by a join */
+    key[0] ^= 0xff;
+    gnrc_lorawan_calculate_mic_uplink(&pkt, 0x00, &mac, &calc_mic);
+    TEST_ASSERT(memcmp(&calc_mic, mic, sizeof(le_uint32_t)) != 0);
+
+    key[0] ^= 0xff;
+    gnrc_lorawan_calculate_mic_uplink(&pkt, 0x00, &mac, &calc_mic);
+    TEST_ASSERT(memcmp(&calc_mic, mic, sizeof(le_uint32_t)) == 0);
+}
+
 static void test_gnrc_lorawan__build_hdr(void)
 {
     uint8_t buf[sizeof(lorawan_hdr_t)];
@@ -176,6 +204,7 @@ Test *tests_gnrc_lorawan_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_gnrc_lorawan__validate_mic),
         new_TestFixture(test_gnrc_lorawan__wrong_mic),
+        new_TestFixture(test_gnrc_lorawan__mic_key_change),
         new_TestFixture(test_gnrc_lorawan__build_hdr),
         new_TestFixture(test_gnrc_lorawan_fopts__mlme_link_check_req),
         new_TestFixture(test_gnrc_lorawan_fopts__perform),
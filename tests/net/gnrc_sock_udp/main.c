@@ -518,6 +518,88 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t results[3];
+    iolist_t tail = {
+        .iol_base = &_test_buffer[4],
+        .iol_len = 4,
+    };
+    iolist_t snips[3] = {
+        { .iol_base = &_test_buffer[0], .iol_len = 4, .iol_next = &tail },
+        { .iol_base = &_test_buffer[8], .iol_len = 8 },
+        { .iol_base = &_test_buffer[16], .iol_len = 8 },
+    };
+    sock_udp_msg_t msgs[3] = {
+        { .snips = &snips[0], .remote = &results[0] },
+        { .snips = &snips[1], .remote = &results[1] },
+        { .snips = &snips[2], .remote = &results[2] },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCDEFG", sizeof("ABCDEFG"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "HIJK", sizeof("HIJK"),
+                          _TEST_NETIF));
+    /* only takes the datagrams already received */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCDEFG") == msgs[0].len);
+    expect(memcmp(&_test_buffer[0], "ABCDEFG", sizeof("ABCDEFG")) == 0);
+    expect(sizeof("HIJK") == msgs[1].len);
+    expect(memcmp(&_test_buffer[8], "HIJK", sizeof("HIJK")) == 0);
+    expect(memcmp(&results[0].addr, &src_addr, sizeof(src_addr)) == 0);
+    expect(_TEST_PORT_REMOTE == results[0].port);
+    expect(_TEST_PORT_REMOTE + 1 == results[1].port);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many__ENOBUFS(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    iolist_t snips[2] = {
+        { .iol_base = &_test_buffer[0], .iol_len = 8 },
+        { .iol_base = &_test_buffer[8], .iol_len = 2 },
+    };
+    sock_udp_msg_t msgs[2] = {
+        { .snips = &snips[0] },
+        { .snips = &snips[1] },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                          _TEST_NETIF));
+    /* the second datagram does not fit and is left for the next call */
+    expect(1 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(1 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(sizeof("EFGH") == msgs[0].len);
+    expect(memcmp(&_test_buffer[0], "EFGH", sizeof("EFGH")) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    /* the first datagram is dropped if it does not fit, as with
+     * sock_udp_recv() */
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(-ENOBUFS == sock_udp_recv_many(&_sock, &msgs[1], 1, 0));
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -685,6 +767,97 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_many__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t other = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                            .family = AF_INET6,
+                            .port = _TEST_PORT_REMOTE + 1 };
+    iolist_t tail = {
+        .iol_base = "EFGH",
+        .iol_len  = sizeof("EFGH"),
+    };
+    iolist_t snips[2] = {
+        { .iol_base = "ABCD", .iol_len = sizeof("ABCD") - 1, .iol_next = &tail },
+        { .iol_base = "IJKL", .iol_len = sizeof("IJKL") },
+    };
+    sock_udp_msg_t msgs[2] = {
+        { .snips = &snips[0] },
+        { .snips = &snips[1], .remote = &other },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(sizeof("ABCDEFGH") == msgs[0].len);
+    expect(sizeof("IJKL") == msgs[1].len);
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCDEFGH", sizeof("ABCDEFGH"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "IJKL", sizeof("IJKL"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_many__udp_thread(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    iolist_t snips[3] = {
+        { .iol_base = "ABCD", .iol_len = sizeof("ABCD") },
+        { .iol_base = "EFGH", .iol_len = sizeof("EFGH") },
+        { .iol_base = "IJKL", .iol_len = sizeof("IJKL") },
+    };
+    sock_udp_msg_t msgs[3] = {
+        { .snips = &snips[0] },
+        { .snips = &snips[1] },
+        { .snips = &snips[2] },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    /* the UDP thread gets all datagrams at once and sends them in order */
+    expect(3 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        expect(sizeof("ABCD") == msgs[i].len);
+        expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                             _TEST_PORT_REMOTE, snips[i].iol_base,
+                             snips[i].iol_len, _TEST_NETIF, false));
+    }
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_many__EINVAL_port(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6 };
+    sock_udp_msg_t msgs[1] = {
+        { .remote = (sock_udp_ep_t *)&remote },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-EINVAL == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -855,6 +1028,8 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__success());
+    CALL(test_sock_udp_recv_many__ENOBUFS());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -866,6 +1041,8 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+    CALL(test_sock_udp_send_many__socketed());
+    CALL(test_sock_udp_send_many__EINVAL_port());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
@@ -873,6 +1050,8 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    _prepare_udp_thread_checks();
+    CALL(test_sock_udp_send_many__udp_thread());
 
     puts("ALL TESTS SUCCESSFUL");
 
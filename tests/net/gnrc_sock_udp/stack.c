@@ -29,6 +29,7 @@
 
 static msg_t _msg_queue[_MSG_QUEUE_SIZE];
 static gnrc_netreg_entry_t _udp_handler;
+static gnrc_netreg_entry_t _ipv6_handler;
 static char _rx_buf[32];
 
 void _net_init(void)
@@ -36,6 +37,8 @@ void _net_init(void)
     msg_init_queue(_msg_queue, _MSG_QUEUE_SIZE);
     gnrc_netreg_entry_init_pid(&_udp_handler, GNRC_NETREG_DEMUX_CTX_ALL,
                                thread_getpid());
+    gnrc_netreg_entry_init_pid(&_ipv6_handler, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
 }
 
 void _prepare_send_checks(void)
@@ -43,6 +46,12 @@ void _prepare_send_checks(void)
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &_udp_handler);
 }
 
+void _prepare_udp_thread_checks(void)
+{
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_udp_handler);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_ipv6_handler);
+}
+
 static gnrc_pktsnip_t *_build_udp_packet(const ipv6_addr_t *src,
                                          const ipv6_addr_t *dst,
                                          uint16_t src_port, uint16_t dst_port,
@@ -39,6 +39,12 @@ void _net_init(void);
  */
 void _prepare_send_checks(void);
 
+/**
+ * @brief   Checks the packets sent after the UDP thread handled them instead
+ *          of the packets sent to the UDP thread
+ */
+void _prepare_udp_thread_checks(void);
+
 /**
  * @brief   Auxiliary data to inject
  */
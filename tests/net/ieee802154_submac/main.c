@@ -32,12 +32,17 @@
 #include "net/netdev/ieee802154_submac.h"
 #include "net/l2util.h"
 #include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
 #include "ztimer.h"
+#include "net/ieee802154_security.h"
 
 #include "test_common.h"
 
 #define MAX_LINE    (80)
 
+#define FLAG_TX_DONE    (1U << 0)
+
 ieee802154_submac_t submac;                                             /**< IEEE 802.15.4 SubMAC descriptor */
 mutex_t lock;                                                           /**< lock used to synchronize SubMAC operation */
 ztimer_t ack_timer;                                                     /**< required for the ACK timer */
@@ -61,6 +66,13 @@ static event_t ev_set_rx = { .handler = _ev_set_rx_handler };           /**< Set
 uint8_t buffer[IEEE802154_FRAME_LEN_MAX];                               /* buffer to store IEEE 802.15.4 frames */
 uint8_t seq;                                                            /* sequence number of IEEE 802.15.4 frame */
 
+static thread_t *_bench_thread;                                         /* thread running txtbench */
+static volatile unsigned _bench_done;                                   /* frames reported by TX Done */
+static volatile bool _bench;                                            /* txtbench is running */
+#if IS_USED(MODULE_IEEE802154_SECURITY)
+static ieee802154_sec_context_t _sec_ctx;                               /* secures the txtbench frames */
+#endif
+
 struct _reg_container {
     int count;  /* device index */
 };
@@ -80,9 +92,11 @@ static const uint8_t payload[] =
 
 static int print_addr(int argc, char **argv);
 static int txtsnd(int argc, char **argv);
+static int txtbench(int argc, char **argv);
 static const shell_command_t shell_commands[] = {
     { "print_addr", "Print IEEE802.15.4 addresses", print_addr },
     { "txtsnd", "Send IEEE 802.15.4 packet", txtsnd },
+    { "txtbench", "Send IEEE 802.15.4 packets back to back, print frames/s", txtbench },
     { NULL, NULL, NULL }
 };
 
@@ -245,6 +259,12 @@ static void submac_tx_done(ieee802154_submac_t *submac, int status,
 {
     (void)info;
     (void)submac;
+    if (_bench) {
+        /* txtbench sends the next frame, don't go back to RX in between */
+        _bench_done++;
+        thread_flags_set(_bench_thread, FLAG_TX_DONE);
+        return;
+    }
     switch (status) {
     case TX_STATUS_SUCCESS:
         puts("Tx complete");
@@ -428,6 +448,100 @@ static int txtsnd(int argc, char **argv)
     return send(addr, res, len);
 }
 
+static int _bench_send(uint8_t *dst, size_t dst_len, size_t len)
+{
+    uint8_t mhr[IEEE802154_MAX_HDR_LEN + IEEE802154_SEC_MAX_AUX_HDR_LEN];
+    uint8_t data[sizeof(payload)];
+    uint8_t mic[IEEE802154_SEC_MAX_MAC_SIZE];
+    uint8_t mic_size = 0;
+    uint8_t flags = IEEE802154_FCF_TYPE_DATA;
+    le_uint16_t pan = byteorder_btols(byteorder_htons(CONFIG_IEEE802154_DEFAULT_PANID));
+
+    if (IS_USED(MODULE_IEEE802154_SECURITY)) {
+        flags |= IEEE802154_FCF_SECURITY_EN;
+    }
+
+    int res = ieee802154_set_frame_hdr(mhr, submac.ext_addr.uint8, IEEE802154_LONG_ADDRESS_LEN,
+                                       dst, dst_len, pan, pan, flags, seq++);
+    if (res < 0) {
+        return res;
+    }
+    uint8_t mhr_len = res;
+
+    memcpy(data, payload, len);
+#if IS_USED(MODULE_IEEE802154_SECURITY)
+    res = ieee802154_sec_encrypt_frame(&_sec_ctx, mhr, &mhr_len, data, len,
+                                       mic, &mic_size, submac.ext_addr.uint8);
+    if (res != 0) {
+        return -EINVAL;
+    }
+#endif
+    if (mhr_len + len + mic_size > IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN) {
+        return -EOVERFLOW;
+    }
+
+    iolist_t iol_mic = { .iol_base = mic, .iol_len = mic_size };
+    iolist_t iol_data = { .iol_next = &iol_mic, .iol_base = data, .iol_len = len };
+    iolist_t pkt = { .iol_next = &iol_data, .iol_base = mhr, .iol_len = mhr_len };
+
+    /* without ieee802154_submac_pipeline the frame is only accepted when the
+     * previous one is done, with it one frame can be queued */
+    while (1) {
+        mutex_lock(&lock);
+        res = ieee802154_send(&submac, &pkt);
+        mutex_unlock(&lock);
+        if (res != -EBUSY) {
+            return res;
+        }
+        thread_flags_wait_any(FLAG_TX_DONE);
+    }
+}
+
+static int txtbench(int argc, char **argv)
+{
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];
+    size_t addr_len;
+
+    if (argc != 4) {
+        puts("Usage: txtbench <long_addr> <len> <count>");
+        return 1;
+    }
+
+    addr_len = l2util_addr_from_str(argv[1], addr);
+    size_t len = atoi(argv[2]);
+    unsigned count = atoi(argv[3]);
+    if ((addr_len == 0) || (len > sizeof(payload)) || (count == 0)) {
+        puts("Usage: txtbench <long_addr> <len> <count>");
+        return 1;
+    }
+
+    _bench_thread = thread_get_active();
+    _bench_done = 0;
+    _bench = true;
+    thread_flags_clear(FLAG_TX_DONE);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < count; i++) {
+        int res = _bench_send(addr, addr_len, len);
+        if (res < 0) {
+            printf("txtbench: frame %u couldn't be sent: %d\n", i, res);
+            count = i;
+            break;
+        }
+    }
+    while (_bench_done < count) {
+        thread_flags_wait_any(FLAG_TX_DONE);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    _bench = false;
+    event_post(EVENT_PRIO_HIGHEST, &ev_set_rx);
+
+    printf("%u frames in %" PRIu32 " us, %" PRIu32 " frames/s\n", count, time,
+           (uint32_t)((uint64_t)count * US_PER_SEC / (time ? time : 1)));
+    return 0;
+}
+
 static int _init(void)
 {
     mutex_init(&lock);
@@ -440,6 +554,10 @@ static int _init(void)
     ack_timer.callback = _ack_timeout;
     ack_timer.arg = NULL;
 
+#if IS_USED(MODULE_IEEE802154_SECURITY)
+    ieee802154_sec_init(&_sec_ctx);
+#endif
+
     luid_base(&long_addr, sizeof(long_addr));
     eui64_set_local(&long_addr);
     eui64_clear_group(&long_addr);
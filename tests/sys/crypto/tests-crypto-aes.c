@@ -64,6 +64,33 @@ static void test_crypto_aes_encrypt(void)
                                      AES_BLOCK_SIZE), "wrong ciphertext");
 }
 
+static void test_crypto_aes_encrypt_key_schedule(void)
+{
+    aes_key_t key;
+    int err;
+    uint8_t data[AES_BLOCK_SIZE];
+
+    err = aes_init_key_schedule(&key, TEST_0_KEY, sizeof(TEST_0_KEY));
+    TEST_ASSERT_EQUAL_INT(CIPHER_INIT_SUCCESS, err);
+
+    aes_encrypt_key_schedule(&key, TEST_0_INP, data);
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_0_ENC, data,
+                                     AES_BLOCK_SIZE), "wrong ciphertext");
+
+    err = aes_init_key_schedule(&key, TEST_1_KEY, sizeof(TEST_1_KEY));
+    TEST_ASSERT_EQUAL_INT(CIPHER_INIT_SUCCESS, err);
+
+    /* encrypt in place */
+    memcpy(data, TEST_1_INP, AES_BLOCK_SIZE);
+    aes_encrypt_key_schedule(&key, data, data);
+    TEST_ASSERT_MESSAGE(1 == compare(TEST_1_ENC, data,
+                                     AES_BLOCK_SIZE), "wrong ciphertext");
+
+    uint8_t unsupported_key[8] = { 0 };
+    err = aes_init_key_schedule(&key, unsupported_key, sizeof(unsupported_key));
+    TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_KEY_SIZE, err);
+}
+
 static void test_crypto_aes_decrypt(void)
 {
     cipher_context_t ctx;
@@ -104,6 +131,7 @@ Test *tests_crypto_aes_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_aes_encrypt),
+        new_TestFixture(test_crypto_aes_encrypt_key_schedule),
         new_TestFixture(test_crypto_aes_decrypt),
         new_TestFixture(test_crypto_aes_init_key_length),
     };
@@ -131,11 +131,46 @@ static void test_psa_delete_single_persistent_key(void)
                                     &output_len));
 }
 
+/**
+ * @brief   A purged persistent key should be read from storage again on its next use
+ */
+static void test_psa_purge_single_persistent_key(void)
+{
+    uint8_t cipher_out[ENCR_OUTPUT_SIZE];
+    uint8_t plain_out[PLAINTEXT_LEN];
+    size_t output_len = 0;
+
+    _test_setup();
+
+    /* Only the second key is in local memory after the setup. Purging a
+       stored key that is not in local memory succeeds as well. */
+    TEST_ASSERT_PSA_SUCCESS(psa_purge_key(key_id_2));
+    TEST_ASSERT_PSA_SUCCESS(psa_purge_key(key_id_2));
+    TEST_ASSERT_PSA_SUCCESS(psa_purge_key(key_id_1));
+
+    /* Unknown and invalid key IDs */
+    TEST_ASSERT_PSA_INVALID_HANDLE(psa_purge_key(PSA_KEY_ID_USER_MAX));
+    TEST_ASSERT_PSA_INVALID_HANDLE(psa_purge_key(PSA_KEY_ID_NULL));
+
+    /* Using the key loads it again */
+    TEST_ASSERT_PSA_SUCCESS(psa_cipher_encrypt(key_id_2, PSA_ALG_CBC_NO_PADDING, PLAINTEXT,
+                                PLAINTEXT_LEN, cipher_out, ENCR_OUTPUT_SIZE, &output_len));
+    TEST_ASSERT_PSA_SUCCESS(psa_purge_key(key_id_2));
+
+    TEST_ASSERT_PSA_SUCCESS(psa_cipher_decrypt(key_id_2, PSA_ALG_CBC_NO_PADDING, cipher_out,
+                                sizeof(cipher_out), plain_out, sizeof(plain_out), &output_len));
+    TEST_ASSERT_MESSAGE(0 == memcmp(plain_out, PLAINTEXT, PLAINTEXT_LEN),
+                                                                "purged key, wrong plaintext");
+
+    _test_destroy_keys();
+}
+
 Test* tests_psa_persistent_single_key_storage(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_psa_store_single_persistent_key),
         new_TestFixture(test_psa_delete_single_persistent_key),
+        new_TestFixture(test_psa_purge_single_persistent_key),
     };
 
     EMB_UNIT_TESTCALLER(tests_psa_persistent_single_key_storage_tests, NULL, NULL, fixtures);
@@ -36,6 +36,8 @@ extern "C" {
                                                     PSA_ERROR_DOES_NOT_EXIST, #func_ " failed");
 #define TEST_ASSERT_PSA_ALREADY_EXISTS(func_)   TEST_ASSERT_MESSAGE(func_ == \
                                                     PSA_ERROR_ALREADY_EXISTS, #func_ " failed");
+#define TEST_ASSERT_PSA_INVALID_HANDLE(func_)   TEST_ASSERT_MESSAGE(func_ == \
+                                                    PSA_ERROR_INVALID_HANDLE, #func_ " failed");
 
 #define AES_128_KEY_SIZE    (16)
 
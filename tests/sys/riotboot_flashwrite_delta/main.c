@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test delta updates with the riotboot flash writer
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "mtd_emulated.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/flashwrite_delta.h"
+#include "riotboot/slot.h"
+
+#include "blob/source.bin.h"
+#include "blob/target.bin.h"
+#if DELTA_HEATSHRINK
+#include "blob/delta.hs.h"
+#define DELTA       delta_hs
+#define DELTA_LEN   delta_hs_len
+#else
+#include "blob/delta.bin.h"
+#define DELTA       delta_bin
+#define DELTA_LEN   delta_bin_len
+#endif
+
+#ifdef CPU_NATIVE
+/* native is not started by riotboot, both slots are free */
+#define SOURCE_SLOT 0
+#define TARGET_SLOT 1
+#else
+/* the test runs from a riotboot slot, the other one receives the update */
+#define TARGET_SLOT riotboot_slot_other()
+#endif
+
+/* RAM backed copy of the source image */
+MTD_EMULATED_DEV(0, 16, 1, 256);
+
+static riotboot_flashwrite_t _writer;
+static riotboot_flashwrite_delta_t _delta;
+
+#ifdef SOURCE_SLOT
+static int _install_source(void)
+{
+    riotboot_flashwrite_init(&_writer, SOURCE_SLOT);
+    if (riotboot_flashwrite_putbytes(&_writer,
+                                     source_bin + RIOTBOOT_FLASHWRITE_SKIPLEN,
+                                     source_bin_len - RIOTBOOT_FLASHWRITE_SKIPLEN,
+                                     false) < 0) {
+        return -1;
+    }
+    return riotboot_flashwrite_finish(&_writer);
+}
+#endif
+
+static int _check_target(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    if (_writer.offset != target_bin_len) {
+        printf("image size %u, expected %u\n", (unsigned)_writer.offset,
+               (unsigned)target_bin_len);
+        return -1;
+    }
+
+    if (riotboot_flashwrite_finish(&_writer) < 0) {
+        return -1;
+    }
+
+    /* the digest would be part of the update manifest */
+    sha256(target_bin, target_bin_len, digest);
+    if (riotboot_flashwrite_verify_sha256(digest, _writer.offset,
+                                          TARGET_SLOT) != 0) {
+        puts("digest mismatch");
+        return -1;
+    }
+
+    return memcmp(riotboot_slot_get_hdr(TARGET_SLOT), target_bin,
+                  target_bin_len) ? -1 : 0;
+}
+
+static int _apply_delta(void)
+{
+    for (size_t pos = 0; pos < DELTA_LEN; pos += CHUNK_SIZE) {
+        size_t len = DELTA_LEN - pos < CHUNK_SIZE ? DELTA_LEN - pos : CHUNK_SIZE;
+
+        if (riotboot_flashwrite_delta_putbytes(&_delta, &DELTA[pos], len) < 0) {
+            return -1;
+        }
+    }
+
+    return riotboot_flashwrite_delta_finish(&_delta);
+}
+
+#ifdef SOURCE_SLOT
+static int _update_from_slot(void)
+{
+    riotboot_flashwrite_init(&_writer, TARGET_SLOT);
+    if (riotboot_flashwrite_delta_init(&_delta, &_writer, SOURCE_SLOT) < 0) {
+        return -1;
+    }
+    if (_apply_delta() < 0) {
+        return -1;
+    }
+    return _check_target();
+}
+
+#endif
+
+static int _update_from_mtd(void)
+{
+    mtd_dev_t *source = &mtd_emulated_dev0.base;
+
+    if (mtd_init(source) < 0 ||
+        mtd_write_page_raw(source, source_bin, 0, 0, source_bin_len) < 0) {
+        return -1;
+    }
+
+    riotboot_flashwrite_init(&_writer, TARGET_SLOT);
+    if (riotboot_flashwrite_delta_init_mtd(&_delta, &_writer, source) < 0) {
+        return -1;
+    }
+    if (_apply_delta() < 0) {
+        return -1;
+    }
+    return _check_target();
+}
+
+int main(void)
+{
+    int failed = 0;
+
+#ifdef SOURCE_SLOT
+    if (_install_source() < 0) {
+        puts("writing source image failed");
+        return 1;
+    }
+
+    if (_update_from_slot() < 0) {
+        puts("update from slot: FAILED");
+        failed++;
+    }
+    else {
+        puts("update from slot: OK");
+    }
+#endif
+
+    if (_update_from_mtd() < 0) {
+        puts("update from MTD: FAILED");
+        failed++;
+    }
+    else {
+        puts("update from MTD: OK");
+    }
+
+#ifndef SOURCE_SLOT
+    /* don't leave a test image the bootloader could pick up */
+    riotboot_flashwrite_invalidate(TARGET_SLOT);
+#endif
+
+    printf("transferred %u of %u bytes (%u%%)\n", (unsigned)DELTA_LEN,
+           (unsigned)target_bin_len,
+           (unsigned)(DELTA_LEN * 100 / target_bin_len));
+
+    puts(failed ? "FAILURE" : "SUCCESS");
+
+    return 0;
+}
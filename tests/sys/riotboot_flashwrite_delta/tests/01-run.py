@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    # only native has a spare slot to hold the source image
+    if os.environ.get("BOARD", "").startswith("native"):
+        child.expect_exact("update from slot: OK")
+    child.expect_exact("update from MTD: OK")
+    child.expect(r"transferred (\d+) of (\d+) bytes")
+    assert int(child.match.group(1)) < int(child.match.group(2))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test and measure the pipelined SUIT payload storage
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "suit.h"
+#include "suit/handlers.h"
+#include "suit/storage.h"
+#include "suit/storage/ram.h"
+#include "suit/transport/pipeline.h"
+#include "ztimer.h"
+
+static uint8_t _payload[PAYLOAD_SIZE];
+static uint8_t _payload_digest[SHA256_DIGEST_LENGTH];
+
+/* CBOR parameters the manifest refers to: two component identifiers, the
+ * payload size and the payload digest */
+enum {
+    CBOR_ID_0       = 0,
+    CBOR_ID_1       = CBOR_ID_0 + 7,
+    CBOR_SIZE       = CBOR_ID_1 + 7,
+    CBOR_DIGEST     = CBOR_SIZE + 5,
+    CBOR_LEN        = CBOR_DIGEST + 6 + SHA256_DIGEST_LENGTH,
+};
+static uint8_t _cbor[CBOR_LEN];
+
+/* storage backend that takes WRITE_DELAY_US per write, like external flash */
+static uint8_t _slow_mem[PAYLOAD_SIZE];
+static unsigned _slow_reads;
+
+static int _slow_start(suit_storage_t *storage, const suit_manifest_t *manifest,
+                       size_t len)
+{
+    (void)storage;
+    (void)manifest;
+    memset(_slow_mem, 0xff, sizeof(_slow_mem));
+    return (len > sizeof(_slow_mem)) ? SUIT_ERR_STORAGE_EXCEEDED : SUIT_OK;
+}
+
+static int _slow_write(suit_storage_t *storage, const suit_manifest_t *manifest,
+                       const uint8_t *buf, size_t offset, size_t len)
+{
+    (void)storage;
+    (void)manifest;
+    if (offset + len > sizeof(_slow_mem)) {
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+    ztimer_sleep(ZTIMER_USEC, WRITE_DELAY_US);
+    memcpy(&_slow_mem[offset], buf, len);
+    return SUIT_OK;
+}
+
+static int _slow_finish(suit_storage_t *storage, const suit_manifest_t *manifest)
+{
+    (void)storage;
+    (void)manifest;
+    return SUIT_OK;
+}
+
+static int _slow_read(suit_storage_t *storage, uint8_t *buf, size_t offset,
+                      size_t len)
+{
+    (void)storage;
+    if (offset + len > sizeof(_slow_mem)) {
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+    _slow_reads++;
+    memcpy(buf, &_slow_mem[offset], len);
+    return SUIT_OK;
+}
+
+static int _slow_install(suit_storage_t *storage,
+                         const suit_manifest_t *manifest)
+{
+    (void)storage;
+    (void)manifest;
+    return SUIT_OK;
+}
+
+static const suit_storage_driver_t _slow_driver = {
+    .start = _slow_start,
+    .write = _slow_write,
+    .finish = _slow_finish,
+    .read = _slow_read,
+    .install = _slow_install,
+};
+
+static suit_storage_t _slow_storage = {
+    .driver = &_slow_driver,
+};
+
+static suit_manifest_t _manifest;
+
+static void _build_cbor(void)
+{
+    static const uint8_t ids[] = {
+        0x82, 0x43, 'r', 'a', 'm', 0x41, '0',   /* [h'ram', h'0'] */
+        0x82, 0x43, 'r', 'a', 'm', 0x41, '1',   /* [h'ram', h'1'] */
+    };
+    uint8_t *pos = &_cbor[CBOR_SIZE];
+
+    memcpy(&_cbor[CBOR_ID_0], ids, sizeof(ids));
+
+    /* uint32 */
+    *pos++ = 0x1a;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        *pos++ = (uint32_t)PAYLOAD_SIZE >> shift;
+    }
+
+    /* bstr .cbor [SUIT_DIGEST_SHA256, bstr digest] */
+    *pos++ = 0x58;
+    *pos++ = 4 + SHA256_DIGEST_LENGTH;
+    *pos++ = 0x82;
+    *pos++ = SUIT_DIGEST_SHA256;
+    *pos++ = 0x58;
+    *pos++ = SHA256_DIGEST_LENGTH;
+    memcpy(pos, _payload_digest, SHA256_DIGEST_LENGTH);
+}
+
+static void _setup(suit_storage_t *storage)
+{
+    memset(&_manifest, 0, sizeof(_manifest));
+    _manifest.buf = _cbor;
+    _manifest.len = sizeof(_cbor);
+    _manifest.components_len = 1;
+    _manifest.component_current = 0;
+    _manifest.components[0].storage_backend = storage;
+    _manifest.components[0].identifier.offset = CBOR_ID_0;
+    _manifest.components[0].param_size.offset = CBOR_SIZE;
+    _manifest.components[0].param_digest.offset = CBOR_DIGEST;
+    suit_storage_start(storage, &_manifest, PAYLOAD_SIZE);
+}
+
+/* emulates a blockwise download, handing each block to the storage */
+static int _download(bool pipelined)
+{
+    suit_storage_t *storage = _manifest.components[0].storage_backend;
+
+    for (size_t offset = 0; offset < PAYLOAD_SIZE; offset += BLOCK_SIZE) {
+        size_t len = PAYLOAD_SIZE - offset;
+        if (len > BLOCK_SIZE) {
+            len = BLOCK_SIZE;
+        }
+
+        ztimer_sleep(ZTIMER_USEC, FETCH_DELAY_US);
+
+        int res = pipelined
+                ? suit_transport_pipeline_write(&_manifest, &_payload[offset],
+                                                offset, len)
+                : suit_storage_write(storage, &_manifest, &_payload[offset],
+                                     offset, len);
+        if (res != SUIT_OK) {
+            return res;
+        }
+    }
+
+    if (pipelined) {
+        int res = suit_transport_pipeline_flush();
+        if (res != SUIT_OK) {
+            return res;
+        }
+    }
+
+    return suit_storage_finish(storage, &_manifest);
+}
+
+/* what the SUIT worker does without the pipeline: read the payload back */
+static void _readback_digest(uint8_t *digest)
+{
+    suit_storage_t *storage = _manifest.components[0].storage_backend;
+    sha256_context_t ctx;
+
+    sha256_init(&ctx);
+    for (size_t pos = 0; pos < PAYLOAD_SIZE; pos += 64) {
+        uint8_t buf[64];
+        size_t len = PAYLOAD_SIZE - pos;
+        if (len > sizeof(buf)) {
+            len = sizeof(buf);
+        }
+        suit_storage_read(storage, buf, pos, len);
+        sha256_update(&ctx, buf, len);
+    }
+    sha256_final(&ctx, digest);
+}
+
+static bool _check(const char *name, const uint8_t *mem, bool pipelined)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    bool payload_ok = memcmp(mem, _payload, PAYLOAD_SIZE) == 0;
+    bool digest_ok = true;
+
+    if (pipelined) {
+        digest_ok = (suit_transport_pipeline_digest(&_manifest, PAYLOAD_SIZE,
+                                                    digest) == SUIT_OK) &&
+                    (memcmp(digest, _payload_digest, sizeof(digest)) == 0);
+    }
+
+    printf("%s: payload %s, digest %s\n", name, payload_ok ? "OK" : "FAIL",
+           digest_ok ? "OK" : "FAIL");
+    return payload_ok && digest_ok;
+}
+
+/* runs the image match condition of the SUIT command sequence on the slow
+ * storage, returns whether the expected result was reached with or without
+ * reading the payload back */
+static bool _image_match(const char *name, int expected, bool read_back)
+{
+    _manifest.components[0].state = SUIT_COMPONENT_STATE_FETCHED;
+    _slow_reads = 0;
+
+    int res = suit_command_sequence_handlers[SUIT_COND_IMAGE_MATCH](
+        &_manifest, SUIT_COND_IMAGE_MATCH, NULL);
+    bool ok = (res == expected) && ((_slow_reads > 0) == read_back);
+
+    printf("%s: %d, %u reads: %s\n", name, res, _slow_reads, ok ? "OK" : "FAIL");
+    return ok;
+}
+
+/* the streamed digest must only be used for the download it belongs to */
+static bool _test_image_match(void)
+{
+    bool ok = true;
+
+    /* right after the download, the streamed digest is used */
+    _setup(&_slow_storage);
+    suit_transport_pipeline_start(&_manifest);
+    ok &= _download(true) == SUIT_OK;
+    ok &= _image_match("match streamed", SUIT_OK, false);
+
+    /* it is used only once, later checks read the storage */
+    ok &= _image_match("match again", SUIT_OK, true);
+    _slow_mem[0] ^= 0xff;
+    ok &= _image_match("match modified", SUIT_ERR_DIGEST_MISMATCH, true);
+
+    /* nor after the manifest has been processed */
+    _setup(&_slow_storage);
+    suit_transport_pipeline_start(&_manifest);
+    ok &= _download(true) == SUIT_OK;
+    suit_transport_pipeline_invalidate();
+    _slow_mem[0] ^= 0xff;
+    ok &= _image_match("match after manifest", SUIT_ERR_DIGEST_MISMATCH, true);
+
+    /* nor for another location of the component */
+    _setup(&_slow_storage);
+    suit_transport_pipeline_start(&_manifest);
+    ok &= _download(true) == SUIT_OK;
+    _manifest.components[0].identifier.offset = CBOR_ID_1;
+    ok &= _image_match("match other location", SUIT_OK, true);
+
+    return ok;
+}
+
+int main(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    bool ok = true;
+
+    for (size_t i = 0; i < sizeof(_payload); i++) {
+        _payload[i] = i * 31 + (i >> 8);
+    }
+    sha256(_payload, sizeof(_payload), _payload_digest);
+    _build_cbor();
+
+    printf("payload: %u bytes in blocks of %u, fetch %u us, write %u us\n",
+           (unsigned)PAYLOAD_SIZE, (unsigned)BLOCK_SIZE,
+           (unsigned)FETCH_DELAY_US, (unsigned)WRITE_DELAY_US);
+
+    /* correctness against a regular storage backend */
+    suit_storage_t *ram = suit_storage_find_by_id(
+        CONFIG_SUIT_STORAGE_RAM_LOCATION_PREFIX "0");
+    suit_storage_set_active_location(ram, CONFIG_SUIT_STORAGE_RAM_LOCATION_PREFIX "0");
+    _setup(ram);
+    suit_transport_pipeline_start(&_manifest);
+    ok &= _download(true) == SUIT_OK;
+    const uint8_t *mem;
+    size_t len;
+    suit_storage_read_ptr(ram, &mem, &len);
+    ok &= len == PAYLOAD_SIZE;
+    ok &= _check("ram", mem, true);
+
+    /* timing against slow storage */
+    _setup(&_slow_storage);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    ok &= _download(false) == SUIT_OK;
+    _readback_digest(digest);
+    uint32_t sequential = ztimer_now(ZTIMER_USEC) - start;
+    ok &= memcmp(digest, _payload_digest, sizeof(digest)) == 0;
+    printf("sequential: %" PRIu32 " us\n", sequential);
+
+    _setup(&_slow_storage);
+    start = ztimer_now(ZTIMER_USEC);
+    suit_transport_pipeline_start(&_manifest);
+    ok &= _download(true) == SUIT_OK;
+    ok &= suit_transport_pipeline_flush() == SUIT_OK;
+    uint32_t pipelined = ztimer_now(ZTIMER_USEC) - start;
+    printf("pipelined: %" PRIu32 " us\n", pipelined);
+    ok &= _check("slow", _slow_mem, true);
+
+    ok &= _test_image_match();
+
+    puts(ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
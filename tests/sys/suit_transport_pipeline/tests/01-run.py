@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT contributors
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("ram: payload OK, digest OK")
+    child.expect(r"sequential: (\d+) us")
+    sequential = int(child.match.group(1))
+    child.expect(r"pipelined: (\d+) us")
+    pipelined = int(child.match.group(1))
+    child.expect_exact("slow: payload OK, digest OK")
+    assert pipelined < sequential, "pipeline did not overlap fetch and write"
+    for check in ("match streamed", "match again", "match modified",
+                  "match after manifest", "match other location"):
+        child.expect(r"{}: -?\d+, \d+ reads: OK".format(check))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -61,10 +61,39 @@ static void test_mbox_put_get(void)
     TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
 }
 
+static void test_mbox_peek(void)
+{
+    mbox_t mbox;
+    msg_t queue[QUEUE_SIZE];
+    msg_t msg = { .type = 0 };
+    mbox_init(&mbox, queue, ARRAY_SIZE(queue));
+    TEST_ASSERT_EQUAL_INT(0, mbox_peek(&mbox, &msg));
+
+    for (unsigned i = 0; i < 2; i++) {
+        msg.type = i;
+        msg.content.value = gen_val(i);
+        TEST_ASSERT_EQUAL_INT(1, mbox_try_put(&mbox, &msg));
+    }
+
+    /* Peeking returns the next item without taking it. */
+    for (unsigned i = 0; i < 2; i++) {
+        msg.type = 4242;
+        TEST_ASSERT_EQUAL_INT(1, mbox_peek(&mbox, &msg));
+        TEST_ASSERT_EQUAL_INT(i, msg.type);
+        TEST_ASSERT_EQUAL_INT(gen_val(i), msg.content.value);
+        TEST_ASSERT_EQUAL_INT(2 - i, mbox_avail(&mbox));
+        TEST_ASSERT_EQUAL_INT(1, mbox_try_get(&mbox, &msg));
+        TEST_ASSERT_EQUAL_INT(i, msg.type);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, mbox_peek(&mbox, &msg));
+}
+
 Test *tests_core_mbox_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_mbox_put_get),
+        new_TestFixture(test_mbox_peek),
     };
 
     EMB_UNIT_TESTCALLER(core_mbox_tests, NULL, NULL, fixtures);
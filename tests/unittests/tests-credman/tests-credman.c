@@ -196,6 +196,69 @@ static void test_credman_get(void)
     TEST_ASSERT(!_compare_credentials(&in_credential, &out_credential));
 }
 
+static void test_credman_get_psk(void)
+{
+    credman_credential_t out_credential;
+    credman_credential_t in_credential = {
+        .tag = CREDMAN_TEST_TAG,
+        .type = CREDMAN_TYPE_PSK,
+        .params = {
+            .psk = {
+                .id = { .s = (void *)"RIOTer", .len = sizeof("RIOTer") - 1 },
+                .key = { .s = (void *)"LGPLisyourfriend",
+                         .len = sizeof("LGPLisyourfriend") - 1 },
+                .hint = { .s = (void *)"hint", .len = sizeof("hint") - 1 },
+            },
+        },
+    };
+    const credman_tag_t tags[] = { CREDMAN_TEST_TAG + 1, CREDMAN_TEST_TAG };
+
+    /* get non-existing credential */
+    TEST_ASSERT_EQUAL_INT(CREDMAN_NOT_FOUND,
+                          credman_get_psk_by_id(&out_credential, tags, ARRAY_SIZE(tags),
+                                                "RIOTer", sizeof("RIOTer") - 1));
+
+    TEST_ASSERT_EQUAL_INT(CREDMAN_OK, credman_add(&in_credential));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_OK,
+                          credman_get_psk_by_id(&out_credential, tags, ARRAY_SIZE(tags),
+                                                "RIOTer", sizeof("RIOTer") - 1));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_TEST_TAG, out_credential.tag);
+    TEST_ASSERT_EQUAL_INT(CREDMAN_OK,
+                          credman_get_psk_by_hint(&out_credential, tags, ARRAY_SIZE(tags),
+                                                  "hint", sizeof("hint") - 1));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_TEST_TAG, out_credential.tag);
+
+    /* prefixes, other identities and tags not in the list do not match */
+    TEST_ASSERT_EQUAL_INT(CREDMAN_NOT_FOUND,
+                          credman_get_psk_by_id(&out_credential, tags, ARRAY_SIZE(tags),
+                                                "RIOT", sizeof("RIOT") - 1));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_NOT_FOUND,
+                          credman_get_psk_by_id(&out_credential, tags, ARRAY_SIZE(tags),
+                                                "hint", sizeof("hint") - 1));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_NOT_FOUND,
+                          credman_get_psk_by_id(&out_credential, tags, 1,
+                                                "RIOTer", sizeof("RIOTer") - 1));
+
+    /* of two matching credentials, the one tagged first in the list wins */
+    in_credential.tag = CREDMAN_TEST_TAG + 1;
+    TEST_ASSERT_EQUAL_INT(CREDMAN_OK, credman_add(&in_credential));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_OK,
+                          credman_get_psk_by_id(&out_credential, tags, ARRAY_SIZE(tags),
+                                                "RIOTer", sizeof("RIOTer") - 1));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_TEST_TAG + 1, out_credential.tag);
+
+    /* deleted credentials are not found anymore */
+    credman_delete(CREDMAN_TEST_TAG + 1, CREDMAN_TYPE_PSK);
+    TEST_ASSERT_EQUAL_INT(CREDMAN_OK,
+                          credman_get_psk_by_hint(&out_credential, tags, ARRAY_SIZE(tags),
+                                                  "hint", sizeof("hint") - 1));
+    TEST_ASSERT_EQUAL_INT(CREDMAN_TEST_TAG, out_credential.tag);
+    credman_delete(CREDMAN_TEST_TAG, CREDMAN_TYPE_PSK);
+    TEST_ASSERT_EQUAL_INT(CREDMAN_NOT_FOUND,
+                          credman_get_psk_by_hint(&out_credential, tags, ARRAY_SIZE(tags),
+                                                  "hint", sizeof("hint") - 1));
+}
+
 static void test_credman_delete(void)
 {
     int ret;
@@ -353,6 +416,7 @@ Test *tests_credman_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_credman_add),
         new_TestFixture(test_credman_get),
+        new_TestFixture(test_credman_get_psk),
         new_TestFixture(test_credman_delete),
         new_TestFixture(test_credman_delete_random_order),
         new_TestFixture(test_credman_add_delete_all),
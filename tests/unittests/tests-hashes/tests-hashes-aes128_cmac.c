@@ -94,6 +94,34 @@ static void test_hashes_cmac(void)
     TEST_ASSERT_EQUAL_INT(calc_and_compare_hash(TEST_3_INP, 64, TEST_3_EXP), 0);
 }
 
+static int calc_and_compare_hash_key(const aes128_cmac_key_t *key,
+                                     const uint8_t *hash, size_t size,
+                                     const uint8_t *expected)
+{
+    uint8_t digest[16];
+    aes128_cmac_context_t ctx;
+
+    aes128_cmac_init_key(&ctx, key);
+    aes128_cmac_update(&ctx, hash, size);
+    aes128_cmac_final(&ctx, digest);
+    return memcmp(digest, expected, 16);
+}
+
+static void test_hashes_cmac_key(void)
+{
+    aes128_cmac_key_t key;
+
+    TEST_ASSERT_EQUAL_INT(aes128_cmac_key_init(&key, AES128_CMAC_KEY, 15),
+                          CIPHER_ERR_INVALID_KEY_SIZE);
+    TEST_ASSERT_EQUAL_INT(aes128_cmac_key_init(&key, AES128_CMAC_KEY, 16),
+                          CIPHER_INIT_SUCCESS);
+    /* the prepared key is reused for all messages */
+    TEST_ASSERT_EQUAL_INT(calc_and_compare_hash_key(&key, NULL, 0, TEST_EMPTY_EXP), 0);
+    TEST_ASSERT_EQUAL_INT(calc_and_compare_hash_key(&key, TEST_1_INP, 16, TEST_1_EXP), 0);
+    TEST_ASSERT_EQUAL_INT(calc_and_compare_hash_key(&key, TEST_2_INP, 40, TEST_2_EXP), 0);
+    TEST_ASSERT_EQUAL_INT(calc_and_compare_hash_key(&key, TEST_3_INP, 64, TEST_3_EXP), 0);
+}
+
 static void test_hashes_cmac_keysize(void)
 {
     aes128_cmac_context_t ctx;
@@ -109,6 +137,7 @@ Test *tests_hashes_cmac_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_hashes_cmac),
         new_TestFixture(test_hashes_cmac_keysize),
+        new_TestFixture(test_hashes_cmac_key),
     };
 
     EMB_UNIT_TESTCALLER(test_hashes_cmac, NULL, NULL, fixtures);
@@ -29,6 +29,7 @@
 
 #include "embUnit/embUnit.h"
 
+#include "container.h"
 #include "hashes/sha256.h"
 
 #include "tests-hashes.h"
@@ -267,6 +268,77 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_multi(void)
+{
+    static const char *teststrings[] = {
+        "1234567890_1",
+        "0123456789abcde-0123456789abcde-0123456789abcde-0123456789abcde-",
+        "",
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+        "RIOT is an open-source microkernel-based operating system, designed"
+        " to match the requirements of Internet of Things (IoT) devices and"
+        " other embedded devices. These requirements include a very low memory"
+        " footprint (on the order of a few kilobytes), high energy efficiency"
+        ", real-time capabilities, communication stacks for both wireless and"
+        " wired networks, and support for a wide range of low-power hardware.",
+        "abc",
+    };
+    static const unsigned char *expected[] = {
+        h01, hdigits_letters, hempty, h_fips_multiblock, hlong_sequence,
+        h_fips_oneblock,
+    };
+    static unsigned char hashes[ARRAY_SIZE(teststrings)][SHA256_DIGEST_LENGTH];
+    const void *data[ARRAY_SIZE(teststrings)];
+    size_t len[ARRAY_SIZE(teststrings)];
+    void *digest[ARRAY_SIZE(teststrings)];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(teststrings); i++) {
+        data[i] = teststrings[i];
+        len[i] = strlen(teststrings[i]);
+        digest[i] = hashes[i];
+    }
+
+    sha256_multi(data, len, ARRAY_SIZE(teststrings), digest);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(teststrings); i++) {
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected[i], hashes[i],
+                                        SHA256_DIGEST_LENGTH));
+    }
+}
+
+static void test_hashes_sha256_update_multi_unaligned(void)
+{
+    static const char *teststring =
+        {"RIOT is an open-source microkernel-based operating system, designed"
+        " to match the requirements of Internet of Things (IoT) devices and"
+        " other embedded devices. These requirements include a very low memory"
+        " footprint (on the order of a few kilobytes), high energy efficiency"
+        ", real-time capabilities, communication stacks for both wireless and"
+        " wired networks, and support for a wide range of low-power hardware."};
+    static unsigned char hash[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx[3];
+    sha256_context_t *cp[] = { &ctx[0], &ctx[1], &ctx[2] };
+    /* start every context at a different offset into the buffer */
+    static const size_t head[] = { 5, 64, 130 };
+    const void *data[3];
+    size_t len[3];
+
+    for (unsigned i = 0; i < 3; i++) {
+        sha256_init(&ctx[i]);
+        sha256_update(&ctx[i], teststring, head[i]);
+        data[i] = teststring + head[i];
+        len[i] = strlen(teststring) - head[i];
+    }
+
+    sha2xx_update_multi(cp, data, len, 3);
+
+    for (unsigned i = 0; i < 3; i++) {
+        sha256_final(&ctx[i], hash);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(hlong_sequence, hash,
+                                        SHA256_DIGEST_LENGTH));
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -285,6 +357,9 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_multi),
+        new_TestFixture(test_hashes_sha256_update_multi_unaligned),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
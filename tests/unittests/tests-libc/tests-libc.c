@@ -75,6 +75,31 @@ static void test_libc_memchk(void)
     TEST_ASSERT(memchk(buffer, 0xff, sizeof(buffer)) == &buffer[5]);
 }
 
+static void test_libc_memchr2(void)
+{
+    uint8_t buffer[67];
+    memset(buffer, 0x55, sizeof(buffer));
+    TEST_ASSERT_NULL(memchr2(buffer, 0xc0, 0xdb, sizeof(buffer)));
+
+    /* every position and alignment, word-wise scanning must not miss any */
+    for (unsigned start = 0; start < 8; start++) {
+        for (unsigned i = start; i < sizeof(buffer); i++) {
+            buffer[i] = (i & 1) ? 0xc0 : 0xdb;
+            TEST_ASSERT(memchr2(&buffer[start], 0xc0, 0xdb,
+                                sizeof(buffer) - start) == &buffer[i]);
+            /* outside of the searched range */
+            TEST_ASSERT_NULL(memchr2(&buffer[start], 0xc0, 0xdb, i - start));
+            buffer[i] = 0x55;
+        }
+    }
+
+    /* bytes differing from the searched ones by a single bit */
+    memset(buffer, 0xc1, sizeof(buffer));
+    buffer[40] = 0x00;
+    TEST_ASSERT_NULL(memchr2(buffer, 0xc0, 0xdb, sizeof(buffer)));
+    TEST_ASSERT(memchr2(buffer, 0xc0, 0x00, sizeof(buffer)) == &buffer[40]);
+}
+
 static void test_libc_reverse_buf3(void)
 {
     const char expected[3] = { 3, 2, 1 };
@@ -154,6 +179,7 @@ Test *tests_libc_tests(void)
         new_TestFixture(test_libc_strscpy),
         new_TestFixture(test_libc_swprintf),
         new_TestFixture(test_libc_memchk),
+        new_TestFixture(test_libc_memchr2),
         new_TestFixture(test_libc_reverse_buf3),
         new_TestFixture(test_libc_reverse_buf4),
         new_TestFixture(test_libc_endian),
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "memarray.h"
+#include "memarray_atomic.h"
+#include "tests-memarray.h"
+
+#define BLOCK_SIZE      (12U)
+#define BLOCKS          (8U)
+
+static uint8_t _data[BLOCKS][BLOCK_SIZE];
+static uint8_t _adata[BLOCKS][BLOCK_SIZE];
+static memarray_t _mem;
+static memarray_atomic_t _amem;
+
+static void set_up(void)
+{
+    memarray_init(&_mem, _data, BLOCK_SIZE, BLOCKS);
+    memarray_atomic_init(&_amem, _adata, BLOCK_SIZE, BLOCKS);
+}
+
+/* every block of @p data is in @p ptrs exactly once */
+static void _assert_all_blocks(const void *data, void **ptrs)
+{
+    uint8_t seen[BLOCKS] = { 0 };
+
+    for (unsigned i = 0; i < BLOCKS; i++) {
+        uintptr_t offset = (uintptr_t)ptrs[i] - (uintptr_t)data;
+
+        TEST_ASSERT(offset < BLOCKS * BLOCK_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, offset % BLOCK_SIZE);
+        seen[offset / BLOCK_SIZE]++;
+    }
+    for (unsigned i = 0; i < BLOCKS; i++) {
+        TEST_ASSERT_EQUAL_INT(1, seen[i]);
+    }
+}
+
+static void test_memarray_alloc_n(void)
+{
+    void *ptrs[BLOCKS];
+
+    TEST_ASSERT_EQUAL_INT(3, memarray_alloc_n(&_mem, ptrs, 3));
+    TEST_ASSERT_EQUAL_INT(BLOCKS - 3, memarray_available(&_mem));
+    /* all or nothing */
+    TEST_ASSERT_EQUAL_INT(0, memarray_alloc_n(&_mem, &ptrs[3], BLOCKS - 2));
+    TEST_ASSERT_EQUAL_INT(BLOCKS - 3, memarray_available(&_mem));
+    TEST_ASSERT_EQUAL_INT(BLOCKS - 3,
+                          memarray_alloc_n(&_mem, &ptrs[3], BLOCKS - 3));
+    TEST_ASSERT_NULL(memarray_alloc(&_mem));
+    _assert_all_blocks(_data, ptrs);
+
+    memarray_free_n(&_mem, ptrs, BLOCKS);
+    TEST_ASSERT_EQUAL_INT(BLOCKS, memarray_available(&_mem));
+}
+
+static void test_memarray_atomic_alloc(void)
+{
+    void *ptrs[BLOCKS];
+
+    for (unsigned i = 0; i < BLOCKS; i++) {
+        ptrs[i] = memarray_atomic_alloc(&_amem);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        memset(ptrs[i], 0xff, BLOCK_SIZE);
+    }
+    TEST_ASSERT_NULL(memarray_atomic_alloc(&_amem));
+    TEST_ASSERT_EQUAL_INT(0, memarray_atomic_available(&_amem));
+    _assert_all_blocks(_adata, ptrs);
+
+    for (unsigned i = 0; i < BLOCKS; i++) {
+        memarray_atomic_free(&_amem, ptrs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(BLOCKS, memarray_atomic_available(&_amem));
+    TEST_ASSERT_EQUAL_INT(BLOCKS, memarray_atomic_high_water(&_amem));
+}
+
+static void test_memarray_atomic_alloc_n(void)
+{
+    void *ptrs[BLOCKS];
+
+    TEST_ASSERT_EQUAL_INT(0, memarray_atomic_alloc_n(&_amem, ptrs, 0));
+    TEST_ASSERT_EQUAL_INT(0, memarray_atomic_alloc_n(&_amem, ptrs,
+                                                     BLOCKS + 1));
+    TEST_ASSERT_EQUAL_INT(5, memarray_atomic_alloc_n(&_amem, ptrs, 5));
+    /* all or nothing */
+    TEST_ASSERT_EQUAL_INT(0, memarray_atomic_alloc_n(&_amem, &ptrs[5], 4));
+    TEST_ASSERT_EQUAL_INT(BLOCKS - 5, memarray_atomic_available(&_amem));
+    TEST_ASSERT_EQUAL_INT(3, memarray_atomic_alloc_n(&_amem, &ptrs[5], 3));
+    _assert_all_blocks(_adata, ptrs);
+
+    /* return them in a different order */
+    memarray_atomic_free_n(&_amem, &ptrs[4], 4);
+    memarray_atomic_free_n(&_amem, ptrs, 4);
+    TEST_ASSERT_EQUAL_INT(BLOCKS, memarray_atomic_available(&_amem));
+    TEST_ASSERT_EQUAL_INT(BLOCKS, memarray_atomic_alloc_n(&_amem, ptrs,
+                                                          BLOCKS));
+    _assert_all_blocks(_adata, ptrs);
+    memarray_atomic_free_n(&_amem, ptrs, BLOCKS);
+}
+
+static void test_memarray_atomic_high_water(void)
+{
+    void *ptrs[BLOCKS];
+
+    TEST_ASSERT_EQUAL_INT(0, memarray_atomic_high_water(&_amem));
+    TEST_ASSERT_EQUAL_INT(6, memarray_atomic_alloc_n(&_amem, ptrs, 6));
+    memarray_atomic_free_n(&_amem, &ptrs[2], 4);
+    TEST_ASSERT_EQUAL_INT(6, memarray_atomic_high_water(&_amem));
+
+    memarray_atomic_reset_high_water(&_amem);
+    TEST_ASSERT_EQUAL_INT(2, memarray_atomic_high_water(&_amem));
+    TEST_ASSERT_NOT_NULL(memarray_atomic_alloc(&_amem));
+    TEST_ASSERT_EQUAL_INT(3, memarray_atomic_high_water(&_amem));
+}
+
+static Test *tests_memarray_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_memarray_alloc_n),
+        new_TestFixture(test_memarray_atomic_alloc),
+        new_TestFixture(test_memarray_atomic_alloc_n),
+        new_TestFixture(test_memarray_atomic_high_water),
+    };
+
+    EMB_UNIT_TESTCALLER(memarray_tests, set_up, NULL, fixtures);
+
+    return (Test *)&memarray_tests;
+}
+
+void tests_memarray(void)
+{
+    TESTS_RUN(tests_memarray_tests());
+}
+/** @} */
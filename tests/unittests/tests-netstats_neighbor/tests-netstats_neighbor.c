@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "net/netif.h"
+#include "net/netstats/neighbor.h"
+#include "xtimer.h"
+#include "tests-netstats_neighbor.h"
+
+#define ADDR_LEN    (2U)
+
+static netif_t _netif;
+
+static void set_up(void)
+{
+    netstats_nb_init(&_netif);
+}
+
+static const uint8_t *_addr(unsigned i)
+{
+    static uint8_t addr[ADDR_LEN];
+
+    addr[0] = 0x10;
+    addr[1] = i;
+    return addr;
+}
+
+static bool _known(unsigned i)
+{
+    netstats_nb_t stats;
+
+    return netstats_nb_get(&_netif, _addr(i), ADDR_LEN, &stats);
+}
+
+/* fill the table, every neighbor seen @p rx_per_neighbor times */
+static void _fill(unsigned rx_per_neighbor)
+{
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        for (unsigned j = 0; j < rx_per_neighbor; j++) {
+            TEST_ASSERT_NOT_NULL(netstats_nb_update_rx(&_netif, _addr(i),
+                                                       ADDR_LEN, 0, 0));
+        }
+    }
+}
+
+static void test_netstats_nb_get(void)
+{
+    netstats_nb_t stats;
+
+    TEST_ASSERT(!_known(0));
+    _fill(1);
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        TEST_ASSERT(netstats_nb_get(&_netif, _addr(i), ADDR_LEN, &stats));
+        TEST_ASSERT_EQUAL_INT(ADDR_LEN, stats.l2_addr_len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(stats.l2_addr, _addr(i), ADDR_LEN));
+    }
+    TEST_ASSERT(!_known(NETSTATS_NB_SIZE));
+    /* same prefix, different length */
+    TEST_ASSERT(!netstats_nb_get(&_netif, _addr(0), 1, &stats));
+}
+
+static void test_netstats_nb_replace_stale(void)
+{
+    unsigned known = 0, missing = 0;
+
+    /* seen only once, so none of the neighbors is fresh */
+    _fill(1);
+    TEST_ASSERT_NOT_NULL(netstats_nb_update_rx(&_netif, _addr(NETSTATS_NB_SIZE),
+                                               ADDR_LEN, 0, 0));
+    TEST_ASSERT(_known(NETSTATS_NB_SIZE));
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        if (_known(i)) {
+            known++;
+        }
+        else {
+            missing = i;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(NETSTATS_NB_SIZE - 1, known);
+
+    /* the replaced neighbor is found again once it shows up again */
+    TEST_ASSERT_NOT_NULL(netstats_nb_update_rx(&_netif, _addr(missing),
+                                               ADDR_LEN, 0, 0));
+    TEST_ASSERT(_known(missing));
+    known = 0;
+    for (unsigned i = 0; i <= NETSTATS_NB_SIZE; i++) {
+        if (_known(i)) {
+            known++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(NETSTATS_NB_SIZE, known);
+}
+
+static void test_netstats_nb_keep_fresh(void)
+{
+    _fill(NETSTATS_NB_FRESHNESS_TARGET);
+    TEST_ASSERT_NULL(netstats_nb_update_rx(&_netif, _addr(NETSTATS_NB_SIZE),
+                                           ADDR_LEN, 0, 0));
+    TEST_ASSERT(!_known(NETSTATS_NB_SIZE));
+    for (unsigned i = 0; i < NETSTATS_NB_SIZE; i++) {
+        TEST_ASSERT(_known(i));
+    }
+}
+
+static netstats_nb_t *_send(uint32_t duration)
+{
+    netstats_nb_record(&_netif, _addr(0), ADDR_LEN);
+    if (duration) {
+        xtimer_usleep(duration);
+    }
+    return netstats_nb_update_tx(&_netif, NETSTATS_NB_SUCCESS, 1);
+}
+
+static void test_netstats_nb_tx_hist(void)
+{
+    const unsigned last = NETSTATS_NB_TX_HIST_BUCKETS - 1;
+    netstats_nb_t *stats;
+
+    stats = _send(0);
+    TEST_ASSERT_NOT_NULL(stats);
+    TEST_ASSERT_EQUAL_INT(1, stats->tx_hist[0]);
+
+    /* everything longer than the second to last bucket ends up in the last */
+    TEST_ASSERT(_send(NETSTATS_NB_TX_HIST_MIN_US << last) == stats);
+    TEST_ASSERT_EQUAL_INT(1, stats->tx_hist[last]);
+    for (unsigned i = 1; i < last; i++) {
+        TEST_ASSERT_EQUAL_INT(0, stats->tx_hist[i]);
+    }
+
+    /* a full bucket halves all of them */
+    stats->tx_hist[0] = UINT16_MAX;
+    TEST_ASSERT(_send(0) == stats);
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX / 2 + 1, stats->tx_hist[0]);
+    TEST_ASSERT_EQUAL_INT(0, stats->tx_hist[last]);
+}
+
+static Test *tests_netstats_neighbor_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netstats_nb_get),
+        new_TestFixture(test_netstats_nb_replace_stale),
+        new_TestFixture(test_netstats_nb_keep_fresh),
+        new_TestFixture(test_netstats_nb_tx_hist),
+    };
+
+    EMB_UNIT_TESTCALLER(netstats_neighbor_tests, set_up, NULL, fixtures);
+
+    return (Test *)&netstats_neighbor_tests;
+}
+
+void tests_netstats_neighbor(void)
+{
+    TESTS_RUN(tests_netstats_neighbor_tests());
+}
+/** @} */
@@ -38,6 +38,17 @@ static saul_reg_t s2 = { NULL, NULL, "S2", &s2_dri };
 static saul_reg_t s3a = { NULL, NULL, "S3", &s3a_dri };
 static saul_reg_t s3b = { NULL, NULL, "S3", &s3b_dri };
 
+static int s4_read(const void *dev, phydat_t *res)
+{
+    res->val[0] = (uintptr_t)dev;
+    return 1;
+}
+
+static const saul_driver_t s4_dri = { s4_read, NULL, SAUL_SENSE_HUM };
+/* not registered, only read */
+static saul_reg_t s4a = { NULL, (void *)4, "S4", &s4_dri };
+static saul_reg_t s4b = { NULL, (void *)5, "S4", &s4_dri };
+
 static int count(void)
 {
     int i = 0;
@@ -166,6 +177,22 @@ static void test_reg_find_type_and_name(void)
     TEST_ASSERT_NULL(dev);
 }
 
+static void test_reg_read_many(void)
+{
+    saul_reg_t *devs[] = { &s4a, NULL, &s4b };
+    phydat_t res[3];
+    int dims[3];
+
+    TEST_ASSERT_EQUAL_INT(2, saul_reg_read_many(devs, 3, res, dims));
+    TEST_ASSERT_EQUAL_INT(1, dims[0]);
+    TEST_ASSERT_EQUAL_INT(4, res[0].val[0]);
+    TEST_ASSERT_EQUAL_INT(-ENODEV, dims[1]);
+    TEST_ASSERT_EQUAL_INT(1, dims[2]);
+    TEST_ASSERT_EQUAL_INT(5, res[2].val[0]);
+
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_read_many(devs, 2, res, NULL));
+}
+
 Test *tests_saul_reg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -175,6 +202,7 @@ Test *tests_saul_reg_tests(void)
         new_TestFixture(test_reg_find_type),
         new_TestFixture(test_reg_find_name),
         new_TestFixture(test_reg_find_type_and_name),
+        new_TestFixture(test_reg_read_many),
     };
 
     EMB_UNIT_TESTCALLER(pkt_tests, NULL, NULL, fixtures);
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 The RIOT contributors
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for buffered files
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+
+#include "tests-vfs.h"
+
+#define _VFS_TEST_BUFFERED_FILESIZE 64
+#define _VFS_TEST_BUFFERED_BUFSIZE  16
+
+static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes);
+static int _mock_fstat(vfs_file_t *filp, struct stat *buf);
+static int _mock_fsync(vfs_file_t *filp);
+
+static uint8_t _file[_VFS_TEST_BUFFERED_FILESIZE];
+static size_t _file_size;
+static int _mock_read_calls;
+static int _mock_write_calls;
+
+static vfs_file_buffer_t _fbuf;
+static uint8_t _buf[_VFS_TEST_BUFFERED_BUFSIZE];
+
+/* lseek is left to the default implementation in vfs, which uses filp->pos */
+static const vfs_file_ops_t _test_buffered_ops = {
+    .read = _mock_read,
+    .write = _mock_write,
+    .fstat = _mock_fstat,
+    .fsync = _mock_fsync,
+};
+
+static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    ++_mock_read_calls;
+    if (filp->pos >= (off_t)_file_size) {
+        return 0;
+    }
+    if (nbytes > _file_size - filp->pos) {
+        nbytes = _file_size - filp->pos;
+    }
+    memcpy(dest, &_file[filp->pos], nbytes);
+    filp->pos += nbytes;
+    return nbytes;
+}
+
+static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    ++_mock_write_calls;
+    if (nbytes > sizeof(_file) - filp->pos) {
+        nbytes = sizeof(_file) - filp->pos;
+    }
+    memcpy(&_file[filp->pos], src, nbytes);
+    filp->pos += nbytes;
+    if (filp->pos > (off_t)_file_size) {
+        _file_size = filp->pos;
+    }
+    return nbytes;
+}
+
+static int _mock_fstat(vfs_file_t *filp, struct stat *buf)
+{
+    (void)filp;
+    buf->st_size = _file_size;
+    return 0;
+}
+
+static int _mock_fsync(vfs_file_t *filp)
+{
+    (void)filp;
+    return 0;
+}
+
+static int _open_buffered(void)
+{
+    int fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_test_buffered_ops, NULL);
+    if ((fd >= 0) && (vfs_setvbuf(fd, &_fbuf, _buf, sizeof(_buf)) < 0)) {
+        vfs_close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void setup(void)
+{
+    static const char text[] = "first line\nsecond line\nthird line\n";
+
+    memcpy(_file, text, sizeof(text) - 1);
+    _file_size = sizeof(text) - 1;
+    _mock_read_calls = 0;
+    _mock_write_calls = 0;
+}
+
+static void test_vfs_buffered__read_ahead(void)
+{
+    char line[16];
+    int fd = _open_buffered();
+    TEST_ASSERT(fd >= 0);
+
+    TEST_ASSERT_EQUAL_INT(11, vfs_readline(fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("first line", line);
+    TEST_ASSERT_EQUAL_INT(12, vfs_readline(fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("second line", line);
+    TEST_ASSERT_EQUAL_INT(11, vfs_readline(fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("third line", line);
+    /* 34 bytes in chunks of 16 */
+    TEST_ASSERT_EQUAL_INT(3, _mock_read_calls);
+    TEST_ASSERT_EQUAL_INT(0, vfs_read(fd, line, sizeof(line)));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered__write_behind(void)
+{
+    struct stat st;
+    int fd = _open_buffered();
+    TEST_ASSERT(fd >= 0);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_lseek(fd, 0, SEEK_SET));
+    for (unsigned i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(4, vfs_write(fd, "abcd", 4));
+    }
+    /* 40 bytes, flushed whenever the next write does not fit */
+    TEST_ASSERT_EQUAL_INT(2, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_file, "abcdabcd", 8));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_fsync(fd));
+    TEST_ASSERT_EQUAL_INT(3, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_file[36], "abcd", 4));
+
+    TEST_ASSERT_EQUAL_INT(8, vfs_write(fd, "12345678", 8));
+    TEST_ASSERT_EQUAL_INT(0, vfs_fstat(fd, &st));
+    TEST_ASSERT_EQUAL_INT(48, st.st_size);
+
+    TEST_ASSERT_EQUAL_INT(2, vfs_write(fd, "xy", 2));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(50, _file_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_file[40], "12345678xy", 10));
+}
+
+static void test_vfs_buffered__read_then_write(void)
+{
+    char data[8];
+    int fd = _open_buffered();
+    TEST_ASSERT(fd >= 0);
+
+    TEST_ASSERT_EQUAL_INT(6, vfs_read(fd, data, 6));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, "first ", 6));
+    /* the write goes to the position seen by the user, not the driver's */
+    TEST_ASSERT_EQUAL_INT(4, vfs_write(fd, "LINE", 4));
+    TEST_ASSERT_EQUAL_INT(7, vfs_read(fd, data, 7));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, "\nsecond", 7));
+    TEST_ASSERT_EQUAL_INT(17, vfs_lseek(fd, 0, SEEK_CUR));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_file, "first LINE\nsecond", 17));
+}
+
+static void test_vfs_buffered__large_access(void)
+{
+    uint8_t data[_VFS_TEST_BUFFERED_BUFSIZE * 2];
+    int fd = _open_buffered();
+    TEST_ASSERT(fd >= 0);
+
+    /* accesses larger than the buffer are passed through */
+    TEST_ASSERT_EQUAL_INT(sizeof(data), vfs_read(fd, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(1, _mock_read_calls);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _file, sizeof(data)));
+
+    memset(data, 'x', sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0, vfs_lseek(fd, 0, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(sizeof(data), vfs_write(fd, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(1, _mock_write_calls);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered__disable(void)
+{
+    char data[4];
+    int fd = _open_buffered();
+    TEST_ASSERT(fd >= 0);
+
+    TEST_ASSERT_EQUAL_INT(4, vfs_write(fd, "ABCD", 4));
+    TEST_ASSERT_EQUAL_INT(0, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0, vfs_setvbuf(fd, NULL, NULL, 0));
+    TEST_ASSERT_EQUAL_INT(1, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_file, "ABCD", 4));
+
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(fd, data, 1));
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(fd, data, 1));
+    TEST_ASSERT_EQUAL_INT(2, _mock_read_calls);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+Test *tests_vfs_buffered_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_buffered__read_ahead),
+        new_TestFixture(test_vfs_buffered__write_behind),
+        new_TestFixture(test_vfs_buffered__read_then_write),
+        new_TestFixture(test_vfs_buffered__large_access),
+        new_TestFixture(test_vfs_buffered__disable),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_buffered_tests, setup, NULL, fixtures);
+
+    return (Test *)&vfs_buffered_tests;
+}
+
+/** @} */